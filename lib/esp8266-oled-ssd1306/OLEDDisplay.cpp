@@ -27,63 +27,515 @@
 
 #include "OLEDDisplay.h"
 
+// Word sized alias of the frame buffer used by the span kernels
+typedef uint32_t __attribute__((__may_alias__)) oled_word_t;
+
+template <OLEDDISPLAY_COLOR COLOR, typename T>
+static inline void applySpanMask(T *target, T mask) __attribute__((always_inline));
+
+template <OLEDDISPLAY_COLOR COLOR, typename T>
+static inline void applySpanMask(T *target, T mask) {
+  switch (COLOR) {
+    case WHITE:   *target |=  mask; break;
+    case BLACK:   *target &= ~mask; break;
+    case INVERSE: *target ^=  mask; break;
+  }
+}
+
+// Applies the row `mask` to `length` consecutive columns of one page.
+// Bytes are written four at a time once the pointer is word aligned.
+template <OLEDDISPLAY_COLOR COLOR>
+static void fillPageSpan(uint8_t *rowPtr, uint16_t length, uint8_t mask) {
+  if (mask == 0xFF && COLOR != INVERSE) {
+    memset(rowPtr, COLOR == WHITE ? 0xFF : 0x00, length);
+    return;
+  }
+
+  while (length && ((uintptr_t) rowPtr & 3)) {
+    applySpanMask<COLOR, uint8_t>(rowPtr++, mask);
+    length--;
+  }
+
+  oled_word_t wordMask = mask * 0x01010101UL;
+  oled_word_t *wordPtr = (oled_word_t *) rowPtr;
+  for (; length >= 4; length -= 4) {
+    applySpanMask<COLOR, oled_word_t>(wordPtr++, wordMask);
+  }
+
+  rowPtr = (uint8_t *) wordPtr;
+  while (length--) {
+    applySpanMask<COLOR, uint8_t>(rowPtr++, mask);
+  }
+}
+
+// Rows of `page` inside the clip rows [minY, maxY]
+static inline uint8_t clipPageMask(int8_t page, int16_t minY, int16_t maxY) __attribute__((always_inline));
+
+static inline uint8_t clipPageMask(int8_t page, int16_t minY, int16_t maxY) {
+  uint8_t mask = 0xFF;
+  if (page == (minY >> 3)) mask &= 0xFF << (minY & 7);
+  if (page == (maxY >> 3)) mask &= 0xFF >> (7 - (maxY & 7));
+  return mask;
+}
+
+// A glyph or image that was already clipped against the clip columns
+// and pages. Rows of the first and the last clip page outside of the
+// clip are masked. The data is stored column by column, `rasterHeight`
+// bytes per column.
+struct GlyphBlit {
+  uint8_t    *buffer;
+  const char *data;
+  uint8_t     rasterHeight;
+  uint16_t    bytesInData;
+  int16_t     xMove;
+  int8_t      firstPage;
+  uint8_t     yOffset;
+  int16_t     firstColumn;
+  int16_t     lastColumn;
+  int8_t      firstRow;
+  int8_t      lastRow;
+  int16_t     clipMinY;
+  int16_t     clipMaxY;
+  int16_t     width;
+  uint8_t     bufferFirstPage;
+};
+
+// Streams the visible columns of a clipped glyph into the page buffer.
+// Page aligned glyphs map every data byte onto exactly one buffer byte,
+// unaligned ones are split between two vertically adjacent pages.
+template <OLEDDISPLAY_COLOR COLOR, bool PAGE_ALIGNED>
+static void blitGlyph(const GlyphBlit &blit) {
+  uint8_t yOffset       = blit.yOffset;
+  uint16_t dataPos      = blit.firstColumn * blit.rasterHeight;
+  // Position of the column in the first glyph page, may be above `buffer`
+  int16_t columnPos     = (blit.firstPage - blit.bufferFirstPage) * DISPLAY_WIDTH + blit.xMove + blit.firstColumn;
+
+  for (int16_t column = blit.firstColumn; column < blit.lastColumn; column++) {
+    // The last column of a font glyph may be truncated
+    int8_t lastRow = min((int16_t) blit.lastRow, (int16_t) (blit.bytesInData - dataPos));
+
+    for (int8_t row = blit.firstRow; row < lastRow; row++) {
+      uint8_t currentByte = pgm_read_byte(blit.data + dataPos + row);
+      if (!currentByte) continue;
+
+      int16_t pos = columnPos + row * DISPLAY_WIDTH;
+      int8_t page = blit.firstPage + row;
+      if (PAGE_ALIGNED) {
+        applySpanMask<COLOR, uint8_t>(blit.buffer + pos, currentByte & clipPageMask(page, blit.clipMinY, blit.clipMaxY));
+      } else {
+        if (page >= (blit.clipMinY >> 3)) {
+          applySpanMask<COLOR, uint8_t>(blit.buffer + pos, (currentByte << yOffset) & clipPageMask(page, blit.clipMinY, blit.clipMaxY));
+        }
+        if (page < (blit.clipMaxY >> 3)) {
+          applySpanMask<COLOR, uint8_t>(blit.buffer + pos + DISPLAY_WIDTH, (currentByte >> (8 - yOffset)) & clipPageMask(page + 1, blit.clipMinY, blit.clipMaxY));
+        }
+      }
+    }
+
+    dataPos += blit.rasterHeight;
+    columnPos++;
+  }
+}
+
+// Decodes PackBits: a header n < 128 is followed by n + 1 literal bytes,
+// n >= 128 repeats the next byte 257 - n times. The stream ends at `end`
+// (if set), all bytes after it are 0. Skipping moves a run at a time.
+struct PackBitsReader {
+  const char *data;
+  const char *end;
+  uint16_t    run;
+  bool        repeat;
+  uint8_t     value;
+
+  bool load() {
+    if (end != NULL && data >= end) return false;
+    uint8_t header = pgm_read_byte(data++);
+    repeat = header >= 128;
+    if (repeat) {
+      run   = 257 - header;
+      value = pgm_read_byte(data++);
+    } else {
+      run   = header + 1;
+    }
+    return true;
+  }
+
+  uint8_t next() {
+    if (run == 0 && !load()) return 0;
+    run--;
+    return repeat ? value : pgm_read_byte(data++);
+  }
+
+  // False once the end of the stream is reached
+  bool skip(uint16_t count) {
+    while (count > 0) {
+      if (run == 0 && !load()) return false;
+      uint16_t step = min(run, count);
+      if (!repeat) data += step;
+      run   -= step;
+      count -= step;
+    }
+    return true;
+  }
+};
+
+// Decodes a packed glyph into the column by column layout of a text run
+static void unpackGlyph(uint8_t *columns, const char *data, uint16_t size, int16_t width, uint8_t rasterHeight) {
+  PackBitsReader reader = {data, data + size, 0, false, 0};
+  for (uint8_t row = 0; row < rasterHeight; row++) {
+    for (int16_t column = 0; column < width; column++) {
+      columns[column * rasterHeight + row] = reader.next();
+    }
+  }
+}
+
+// Same as blitGlyph() for PackBits data stored page by page (like a
+// sprite), so the runs follow the rows. Decoding costs one header read
+// per run instead of one flash read per byte.
+template <OLEDDISPLAY_COLOR COLOR, bool PAGE_ALIGNED>
+static void blitPackedGlyph(const GlyphBlit &blit) {
+  PackBitsReader reader = {blit.data, blit.bytesInData ? blit.data + blit.bytesInData : NULL, 0, false, 0};
+  uint8_t yOffset       = blit.yOffset;
+
+  if (!reader.skip(blit.firstRow * blit.width)) return;
+  for (int8_t row = blit.firstRow; row < blit.lastRow; row++) {
+    int8_t page = blit.firstPage + row;
+    int16_t pos        = (page - blit.bufferFirstPage) * DISPLAY_WIDTH + blit.xMove + blit.firstColumn;
+    uint8_t pageMask   = clipPageMask(page, blit.clipMinY, blit.clipMaxY);
+    uint8_t belowMask  = clipPageMask(page + 1, blit.clipMinY, blit.clipMaxY);
+    bool drawPage      = PAGE_ALIGNED || page >= (blit.clipMinY >> 3);
+    bool drawBelow     = !PAGE_ALIGNED && page < (blit.clipMaxY >> 3);
+
+    if (!reader.skip(blit.firstColumn)) return;
+    for (int16_t column = blit.firstColumn; column < blit.lastColumn; column++, pos++) {
+      uint8_t currentByte = reader.next();
+      if (!currentByte) continue;
+
+      if (PAGE_ALIGNED) {
+        applySpanMask<COLOR, uint8_t>(blit.buffer + pos, currentByte & pageMask);
+      } else {
+        if (drawPage) {
+          applySpanMask<COLOR, uint8_t>(blit.buffer + pos, (currentByte << yOffset) & pageMask);
+        }
+        if (drawBelow) {
+          applySpanMask<COLOR, uint8_t>(blit.buffer + pos + DISPLAY_WIDTH, (currentByte >> (8 - yOffset)) & belowMask);
+        }
+      }
+    }
+    if (!reader.skip(blit.width - blit.lastColumn)) return;
+  }
+}
+
+// Copies the visible columns [firstColumn, lastColumn] and rows
+// [firstRow, lastRow] of a page buffer drawn `xMove` columns to the left
+// into `buffer`, which starts with `bufferFirstPage`. Unaligned `yMove`
+// shifts each column as one 64 bit word.
+template <OLEDDISPLAY_COLOR COLOR>
+static void blitPages(uint8_t *buffer, uint8_t bufferFirstPage, const uint8_t *pages, int16_t xMove, int16_t yMove,
+                      int16_t firstColumn, int16_t lastColumn, int16_t firstRow, int16_t lastRow) {
+  uint8_t firstPage = firstRow >> 3;
+  uint8_t lastPage  = lastRow >> 3;
+
+  for (int16_t x = firstColumn; x <= lastColumn; x++) {
+    const uint8_t *source = pages + (x - xMove);
+    uint8_t *target = buffer + ((firstPage - bufferFirstPage) * DISPLAY_WIDTH + x);
+
+    if (yMove == 0) {
+      for (uint8_t page = firstPage; page <= lastPage; page++) {
+        applySpanMask<COLOR, uint8_t>(target + (page - firstPage) * DISPLAY_WIDTH, source[page * DISPLAY_WIDTH] & clipPageMask(page, firstRow, lastRow));
+      }
+      continue;
+    }
+
+    uint64_t column = 0;
+    for (uint8_t page = 0; page < DISPLAY_HEIGHT / 8; page++) {
+      column |= (uint64_t) source[page * DISPLAY_WIDTH] << (page * 8);
+    }
+    column = yMove > 0 ? column << yMove : column >> -yMove;
+    for (uint8_t page = firstPage; page <= lastPage; page++) {
+      applySpanMask<COLOR, uint8_t>(target + (page - firstPage) * DISPLAY_WIDTH, (column >> (page * 8)) & clipPageMask(page, firstRow, lastRow));
+    }
+  }
+}
+
+// A sprite or XBM that was already clipped, [firstColumn, lastColumn] and
+// [firstRow, lastRow] are the visible columns and rows of the image.
+struct SpriteBlit {
+  uint8_t       *buffer;
+  const uint8_t *data;
+  const uint8_t *mask;
+  int16_t        width;
+  int16_t        xMove;
+  int16_t        yMove;
+  int16_t        firstColumn;
+  int16_t        lastColumn;
+  int16_t        firstRow;
+  int16_t        lastRow;
+  int16_t        clipMinY;
+  int16_t        clipMaxY;
+  uint8_t        bufferFirstPage;
+};
+
+// Masked pixels become the sprite pixel (WHITE) or its inverse (BLACK),
+// INVERSE flips the masked pixels the sprite sets.
+template <OLEDDISPLAY_COLOR COLOR, bool MASKED>
+static inline void applySpriteMask(uint8_t *target, uint8_t bits, uint8_t mask) __attribute__((always_inline));
+
+template <OLEDDISPLAY_COLOR COLOR, bool MASKED>
+static inline void applySpriteMask(uint8_t *target, uint8_t bits, uint8_t mask) {
+  if (!MASKED) {
+    applySpanMask<COLOR, uint8_t>(target, bits & mask);
+    return;
+  }
+  switch (COLOR) {
+    case WHITE:   *target = (*target & ~mask) | (bits & mask); break;
+    case BLACK:   *target = (*target & ~mask) | (~bits & mask); break;
+    case INVERSE: *target ^= bits & mask; break;
+  }
+}
+
+// Draws the 8 rows `bits` of column `x` that start at row `y`, one shift
+// for each of the (at most two) pages they fall into.
+template <OLEDDISPLAY_COLOR COLOR, bool MASKED>
+static inline void blitSpriteByte(const SpriteBlit &blit, int16_t x, int16_t y, uint8_t bits, uint8_t mask) __attribute__((always_inline));
+
+template <OLEDDISPLAY_COLOR COLOR, bool MASKED>
+static inline void blitSpriteByte(const SpriteBlit &blit, int16_t x, int16_t y, uint8_t bits, uint8_t mask) {
+  int8_t page    = y >> 3;
+  uint8_t offset = y & 7;
+  int16_t pos    = (page - blit.bufferFirstPage) * DISPLAY_WIDTH + x;
+
+  if (page >= (blit.clipMinY >> 3)) {
+    applySpriteMask<COLOR, MASKED>(blit.buffer + pos, bits << offset,
+                                   (mask << offset) & clipPageMask(page, blit.clipMinY, blit.clipMaxY));
+  }
+  if (offset && page < (blit.clipMaxY >> 3)) {
+    applySpriteMask<COLOR, MASKED>(blit.buffer + pos + DISPLAY_WIDTH, bits >> (8 - offset),
+                                   (mask >> (8 - offset)) & clipPageMask(page + 1, blit.clipMinY, blit.clipMaxY));
+  }
+}
+
+// Sprites are stored like the frame buffer, `width` bytes per page
+template <OLEDDISPLAY_COLOR COLOR, bool MASKED>
+static void blitSprite(const SpriteBlit &blit) {
+  for (int16_t spritePage = blit.firstRow >> 3; spritePage <= blit.lastRow >> 3; spritePage++) {
+    uint16_t dataPos   = spritePage * blit.width + blit.firstColumn;
+    int16_t x          = blit.xMove + blit.firstColumn;
+    int16_t y          = blit.yMove + spritePage * 8;
+    // Rows of this page outside of [firstRow, lastRow] are skipped
+    uint8_t rowMask    = clipPageMask(spritePage, blit.firstRow, blit.lastRow);
+
+    for (int16_t column = blit.firstColumn; column <= blit.lastColumn; column++, dataPos++, x++) {
+      uint8_t bits = pgm_read_byte(blit.data + dataPos) & rowMask;
+      uint8_t mask = MASKED ? pgm_read_byte(blit.mask + dataPos) & rowMask : 0xFF;
+      if (MASKED ? !mask : !bits) continue;
+      blitSpriteByte<COLOR, MASKED>(blit, x, y, bits, mask);
+    }
+  }
+}
+
+// Transposes 8 XBM rows (bit n is column n) into 8 page bytes (bit n is
+// row n), see Hacker's Delight 7-3
+static inline void transposeXbm(const uint8_t rows[8], uint8_t columns[8]) {
+  uint32_t x = (uint32_t) rows[7] << 24 | (uint32_t) rows[6] << 16 | rows[5] << 8 | rows[4];
+  uint32_t y = (uint32_t) rows[3] << 24 | (uint32_t) rows[2] << 16 | rows[1] << 8 | rows[0];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  for (uint8_t i = 0; i < 4; i++) {
+    columns[i]     = y >> (i * 8);
+    columns[i + 4] = x >> (i * 8);
+  }
+}
+
+// XBMs are stored row by row, so every block of 8x8 pixels is transposed
+// into page bytes first
+template <OLEDDISPLAY_COLOR COLOR>
+static void blitXbm(const SpriteBlit &blit) {
+  uint16_t widthInXbm = (blit.width + 7) / 8;
+  uint8_t rows[8];
+  uint8_t columns[8];
+
+  for (int16_t blockRow = blit.firstRow & ~7; blockRow <= blit.lastRow; blockRow += 8) {
+    for (int16_t xbmColumn = blit.firstColumn / 8; xbmColumn <= blit.lastColumn / 8; xbmColumn++) {
+      bool empty = true;
+      for (uint8_t row = 0; row < 8; row++) {
+        int16_t y = blockRow + row;
+        rows[row] = y >= blit.firstRow && y <= blit.lastRow ? pgm_read_byte(blit.data + xbmColumn + y * widthInXbm) : 0;
+        empty = empty && !rows[row];
+      }
+      if (empty) continue;
+
+      transposeXbm(rows, columns);
+
+      int16_t firstColumn = max(blit.firstColumn, (int16_t) (xbmColumn * 8));
+      int16_t lastColumn  = min(blit.lastColumn, (int16_t) (xbmColumn * 8 + 7));
+      for (int16_t column = firstColumn; column <= lastColumn; column++) {
+        uint8_t bits = columns[column & 7];
+        if (bits) {
+          blitSpriteByte<COLOR, false>(blit, blit.xMove + column, blit.yMove + blockRow, bits, 0xFF);
+        }
+      }
+    }
+  }
+}
+
 bool OLEDDisplay::init() {
   if (!this->connect()) {
     DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Can't establish connection to display\n");
     return false;
   }
-  this->buffer = (uint8_t*) malloc(sizeof(uint8_t) * DISPLAY_BUFFER_SIZE);
+  if (!allocateBuffers()) {
+    return false;
+  }
+
+  // The new buffer may hold anything
+  memset(this->inkMinX, 0, sizeof(this->inkMinX));
+  memset(this->inkMaxX, DISPLAY_WIDTH - 1, sizeof(this->inkMaxX));
+  invalidate();
+
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  memset(this->pendingColumns, 0, sizeof(this->pendingColumns));
+  this->pendingPages = 0;
+  this->pendingStartLine = -1;
+  #endif
+
+  #ifdef OLEDDISPLAY_HASH_DIFF
+  memset(this->segmentHash, 0, sizeof(this->segmentHash));
+  this->lastRefresh = millis();
+  #endif
+
+  #ifdef OLEDDISPLAY_BANDED
+  beginBand(0);
+  #endif
+
+  sendInitCommands();
+  resetDisplay();
+
+  return true;
+}
+
+bool OLEDDisplay::allocateBuffers() {
+  #ifdef OLEDDISPLAY_STATIC_BUFFER
+  #ifdef OLEDDISPLAY_BANDED
+  this->bandBuffer = this->bandStorage;
+  #else
+  this->buffer = this->bufferStorage;
+  #endif
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  this->buffer_back = this->backStorage;
+  #endif
+  #else
+  #ifdef OLEDDISPLAY_BANDED
+  if (!this->bandBuffer) {
+    this->bandBuffer = (uint8_t*) malloc(sizeof(uint8_t) * DISPLAY_WIDTH * OLEDDISPLAY_BAND_PAGES);
+  }
+  if(!this->bandBuffer) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create display\n");
+    return false;
+  }
+  #else
+  if (!this->buffer) {
+    this->buffer = (uint8_t*) malloc(sizeof(uint8_t) * DISPLAY_BUFFER_SIZE);
+  }
   if(!this->buffer) {
     DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create display\n");
     return false;
   }
+  #endif
 
   #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-  this->buffer_back = (uint8_t*) malloc(sizeof(uint8_t) * DISPLAY_BUFFER_SIZE);
+  if (!this->buffer_back) {
+    this->buffer_back = (uint8_t*) malloc(sizeof(uint8_t) * DISPLAY_BUFFER_SIZE);
+  }
   if(!this->buffer_back) {
     DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create back buffer\n");
-    free(this->buffer);
     return false;
   }
   #endif
-
-  sendInitCommands();
-  resetDisplay();
-
+  #endif
   return true;
 }
 
 void OLEDDisplay::end() {
+  #ifndef OLEDDISPLAY_STATIC_BUFFER
+  #ifdef OLEDDISPLAY_BANDED
+  if (this->bandBuffer) free(this->bandBuffer);
+  #else
   if (this->buffer) free(this->buffer);
+  #endif
   #ifdef OLEDDISPLAY_DOUBLE_BUFFER
   if (this->buffer_back) free(this->buffer_back);
   #endif
+  #endif
+
+  #ifdef OLEDDISPLAY_BANDED
+  this->bandBuffer = NULL;
+  #endif
+  this->buffer = NULL;
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  this->buffer_back = NULL;
+  #endif
+  this->textCache.setSize(0);
+  this->fontCache.setSize(0);
+  this->hotFont = NULL;
 }
 
 void OLEDDisplay::resetDisplay(void) {
+  #ifdef OLEDDISPLAY_BANDED
+  invalidate();
+  firstBand();
+  while (nextBand());
+  #else
   clear();
   #ifdef OLEDDISPLAY_DOUBLE_BUFFER
   memset(buffer_back, 1, DISPLAY_BUFFER_SIZE);
   #endif
+  invalidate();
   display();
+  #endif
 }
 
 void OLEDDisplay::setColor(OLEDDISPLAY_COLOR color) {
+  if (this->recordList) {
+    this->recordList->put8(LIST_COLOR);
+    this->recordList->put8(color);
+  }
   this->color = color;
 }
 
 void OLEDDisplay::setPixel(int16_t x, int16_t y) {
-  if (x >= 0 && x < 128 && y >= 0 && y < 64) {
+  if (this->recordList) {
+    int16_t args[] = {x, y};
+    recordCommand(LIST_PIXEL, args, 2);
+    return;
+  }
+  if (x >= clipMinX && x <= clipMaxX && y >= clipMinY && y <= clipMaxY) {
+    markDirty(x, x, y >> 3, y >> 3);
     switch (color) {
-      case WHITE:   buffer[x + (y / 8) * DISPLAY_WIDTH] |=  (1 << (y & 7)); break;
-      case BLACK:   buffer[x + (y / 8) * DISPLAY_WIDTH] &= ~(1 << (y & 7)); break;
-      case INVERSE: buffer[x + (y / 8) * DISPLAY_WIDTH] ^=  (1 << (y & 7)); break;
+      case WHITE:   *pagePtr(y >> 3, x) |=  (1 << (y & 7)); break;
+      case BLACK:   *pagePtr(y >> 3, x) &= ~(1 << (y & 7)); break;
+      case INVERSE: *pagePtr(y >> 3, x) ^=  (1 << (y & 7)); break;
     }
   }
 }
 
 // Bresenham's algorithm - thx wikipedia and Adafruit_GFX
 void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  if (this->recordList) {
+    int16_t args[] = {x0, y0, x1, y1};
+    recordCommand(LIST_LINE, args, 4);
+    return;
+  }
+  if (!isVisible(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1)) return;
+
   int16_t steep = abs(y1 - y0) > abs(x1 - x0);
   if (steep) {
     _swap_int16_t(x0, y0);
@@ -123,6 +575,11 @@ void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
 }
 
 void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height) {
+  if (this->recordList) {
+    int16_t args[] = {x, y, width, height};
+    recordCommand(LIST_RECT, args, 4);
+    return;
+  }
   drawHorizontalLine(x, y, width);
   drawVerticalLine(x, y, height);
   drawVerticalLine(x + width - 1, y, height);
@@ -130,12 +587,63 @@ void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height)
 }
 
 void OLEDDisplay::fillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height) {
-  for (int16_t x = xMove; x < xMove + width; x++) {
-    drawVerticalLine(x, yMove, height);
+  if (this->recordList) {
+    int16_t args[] = {xMove, yMove, width, height};
+    recordCommand(LIST_FILL_RECT, args, 4);
+    return;
+  }
+  // Clip the rectangle once instead of once per column
+  if (xMove < clipMinX) {
+    width -= clipMinX - xMove;
+    xMove = clipMinX;
+  }
+  if (yMove < clipMinY) {
+    height -= clipMinY - yMove;
+    yMove = clipMinY;
+  }
+  if ((xMove + width) > clipMaxX + 1) {
+    width = clipMaxX + 1 - xMove;
+  }
+  if ((yMove + height) > clipMaxY + 1) {
+    height = clipMaxY + 1 - yMove;
+  }
+
+  if (width <= 0 || height <= 0) return;
+
+  uint8_t firstPage = yMove >> 3;
+  uint8_t lastPage  = (yMove + height - 1) >> 3;
+
+  // Masks of the rows covered in the first and the last page
+  uint8_t topMask    = 0xFF << (yMove & 7);
+  uint8_t bottomMask = 0xFF >> (7 - ((yMove + height - 1) & 7));
+
+  uint8_t *rowPtr = pagePtr(firstPage, xMove);
+
+  markDirty(xMove, xMove + width - 1, firstPage, lastPage);
+
+  for (uint8_t page = firstPage; page <= lastPage; page++) {
+    uint8_t mask = 0xFF;
+    if (page == firstPage) mask &= topMask;
+    if (page == lastPage)  mask &= bottomMask;
+
+    switch (color) {
+      case WHITE:   fillPageSpan<WHITE>(rowPtr, width, mask); break;
+      case BLACK:   fillPageSpan<BLACK>(rowPtr, width, mask); break;
+      case INVERSE: fillPageSpan<INVERSE>(rowPtr, width, mask); break;
+    }
+
+    rowPtr += DISPLAY_WIDTH;
   }
 }
 
 void OLEDDisplay::drawCircle(int16_t x0, int16_t y0, int16_t radius) {
+  if (this->recordList) {
+    int16_t args[] = {x0, y0, radius};
+    recordCommand(LIST_CIRCLE, args, 3);
+    return;
+  }
+  if (radius > 0 && !isVisible(x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1)) return;
+
   int16_t x = 0, y = radius;
 	int16_t dp = 1 - radius;
 	do {
@@ -162,6 +670,13 @@ void OLEDDisplay::drawCircle(int16_t x0, int16_t y0, int16_t radius) {
 }
 
 void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads) {
+  if (this->recordList) {
+    int16_t args[] = {x0, y0, radius, quads};
+    recordCommand(LIST_CIRCLE_QUADS, args, 4);
+    return;
+  }
+  if (radius > 0 && !isVisible(x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1)) return;
+
   int16_t x = 0, y = radius;
   int16_t dp = 1 - radius;
   while (x < y) {
@@ -202,6 +717,13 @@ void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_
 
 
 void OLEDDisplay::fillCircle(int16_t x0, int16_t y0, int16_t radius) {
+  if (this->recordList) {
+    int16_t args[] = {x0, y0, radius};
+    recordCommand(LIST_FILL_CIRCLE, args, 3);
+    return;
+  }
+  if (radius > 0 && !isVisible(x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1)) return;
+
   int16_t x = 0, y = radius;
 	int16_t dp = 1 - radius;
 	do {
@@ -222,161 +744,336 @@ void OLEDDisplay::fillCircle(int16_t x0, int16_t y0, int16_t radius) {
 }
 
 void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
-  if (y < 0 || y >= DISPLAY_HEIGHT) { return; }
+  fillRect(x, y, length, 1);
+}
 
-  if (x < 0) {
-    length += x;
-    x = 0;
-  }
+void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
+  fillRect(x, y, 1, length);
+}
 
-  if ( (x + length) > DISPLAY_WIDTH) {
-    length = (DISPLAY_WIDTH - x);
+void OLEDDisplay::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress) {
+  if (this->recordList) {
+    int16_t args[] = {(int16_t) x, (int16_t) y, (int16_t) width, (int16_t) height, progress};
+    recordCommand(LIST_PROGRESS_BAR, args, 5);
+    // The bar leaves the color WHITE
+    this->color = WHITE;
+    return;
   }
+  uint16_t radius = height / 2;
+  uint16_t xRadius = x + radius;
+  uint16_t yRadius = y + radius;
+  uint16_t doubleRadius = 2 * radius;
+  uint16_t innerRadius = radius - 2;
 
-  if (length <= 0) { return; }
+  setColor(WHITE);
+  drawCircleQuads(xRadius, yRadius, radius, 0b00000110);
+  drawHorizontalLine(xRadius, y, width - doubleRadius + 1);
+  drawHorizontalLine(xRadius, y + height, width - doubleRadius + 1);
+  drawCircleQuads(x + width - radius, yRadius, radius, 0b00001001);
 
-  uint8_t * bufferPtr = buffer;
-  bufferPtr += (y >> 3) * DISPLAY_WIDTH;
-  bufferPtr += x;
+  uint16_t maxProgressWidth = (width - doubleRadius - 1) * progress / 100;
 
-  uint8_t drawBit = 1 << (y & 7);
+  fillCircle(xRadius, yRadius, innerRadius);
+  fillRect(xRadius + 1, y + 2, maxProgressWidth, height - 3);
+  fillCircle(xRadius + maxProgressWidth, yRadius, innerRadius);
+}
 
-  switch (color) {
-    case WHITE:   while (length--) {
-        *bufferPtr++ |= drawBit;
-      }; break;
-    case BLACK:   drawBit = ~drawBit;   while (length--) {
-        *bufferPtr++ &= drawBit;
-      }; break;
-    case INVERSE: while (length--) {
-        *bufferPtr++ ^= drawBit;
-      }; break;
+void OLEDDisplay::drawFastImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *image) {
+  if (this->recordList) {
+    int16_t args[] = {xMove, yMove, width, height};
+    recordCommand(LIST_FAST_IMAGE, args, 4);
+    this->recordList->putRef(image);
+    return;
   }
+  drawInternal(xMove, yMove, width, height, image, 0, 0);
 }
 
-void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
-  if (x < 0 || x >= DISPLAY_WIDTH) return;
-
-  if (y < 0) {
-    length += y;
-    y = 0;
+void OLEDDisplay::drawPackedSprite(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *sprite) {
+  if (this->recordList) {
+    int16_t args[] = {xMove, yMove, width, height};
+    recordCommand(LIST_PACKED_SPRITE, args, 4);
+    this->recordList->putRef(sprite);
+    return;
   }
+  drawInternal(xMove, yMove, width, height, (const char *) sprite, 0, 0, true);
+}
 
-  if ( (y + length) > DISPLAY_HEIGHT) {
-    length = (DISPLAY_HEIGHT - y);
+void OLEDDisplay::drawPageBuffer(int16_t xMove, int16_t yMove, const uint8_t *pages) {
+  if (this->recordList) {
+    this->recordList->invalidate();
+    return;
   }
+  if (!isVisible(xMove, yMove, DISPLAY_WIDTH, DISPLAY_HEIGHT)) return;
 
-  if (length <= 0) return;
-
+  int16_t firstColumn = max(xMove, clipMinX);
+  int16_t lastColumn  = min((int16_t) (xMove + DISPLAY_WIDTH - 1), clipMaxX);
+  int16_t firstRow    = max(yMove, clipMinY);
+  int16_t lastRow     = min((int16_t) (yMove + DISPLAY_HEIGHT - 1), clipMaxY);
 
-  uint8_t yOffset = y & 7;
-  uint8_t drawBit;
-  uint8_t *bufferPtr = buffer;
+  markDirty(firstColumn, lastColumn, firstRow >> 3, lastRow >> 3);
 
-  bufferPtr += (y >> 3) * DISPLAY_WIDTH;
-  bufferPtr += x;
-
-  if (yOffset) {
-    yOffset = 8 - yOffset;
-    drawBit = ~(0xFF >> (yOffset));
+  switch (this->color) {
+    case WHITE:   blitPages<WHITE>(buffer, bufferFirstPage, pages, xMove, yMove, firstColumn, lastColumn, firstRow, lastRow); break;
+    case BLACK:   blitPages<BLACK>(buffer, bufferFirstPage, pages, xMove, yMove, firstColumn, lastColumn, firstRow, lastRow); break;
+    case INVERSE: blitPages<INVERSE>(buffer, bufferFirstPage, pages, xMove, yMove, firstColumn, lastColumn, firstRow, lastRow); break;
+  }
+}
 
-    if (length < yOffset) {
-      drawBit &= (0xFF >> (yOffset - length));
-    }
+void OLEDDisplay::copyPageRows(const uint8_t *pages, int16_t firstRow, int16_t rows) {
+  if (this->recordList) {
+    this->recordList->invalidate();
+    return;
+  }
+  int16_t lastRow = min((int16_t) (firstRow + rows - 1), clipMaxY);
+  firstRow = max(firstRow, clipMinY);
+  if (firstRow > lastRow || clipMinX > clipMaxX) return;
 
-    switch (color) {
-      case WHITE:   *bufferPtr |=  drawBit; break;
-      case BLACK:   *bufferPtr &= ~drawBit; break;
-      case INVERSE: *bufferPtr ^=  drawBit; break;
-    }
+  markDirty(clipMinX, clipMaxX, firstRow / 8, lastRow / 8);
 
-    if (length < yOffset) return;
+  for (uint8_t page = firstRow / 8; page <= lastRow / 8; page++) {
+    uint8_t *target = pagePtr(page);
+    const uint8_t *source = pages + page * DISPLAY_WIDTH;
 
-    length -= yOffset;
-    bufferPtr += DISPLAY_WIDTH;
-  }
+    // Rows of this page that are replaced
+    uint8_t mask = clipPageMask(page, firstRow, lastRow);
 
-  if (length >= 8) {
-    switch (color) {
-      case WHITE:
-      case BLACK:
-        drawBit = (color == WHITE) ? 0xFF : 0x00;
-        do {
-          *bufferPtr = drawBit;
-          bufferPtr += DISPLAY_WIDTH;
-          length -= 8;
-        } while (length >= 8);
-        break;
-      case INVERSE:
-        do {
-          *bufferPtr = ~(*bufferPtr);
-          bufferPtr += DISPLAY_WIDTH;
-          length -= 8;
-        } while (length >= 8);
-        break;
+    if (mask == 0xFF) {
+      memcpy(target + clipMinX, source + clipMinX, clipMaxX - clipMinX + 1);
+      continue;
+    }
+    for (uint8_t x = clipMinX; x <= clipMaxX; x++) {
+      target[x] = (target[x] & ~mask) | (source[x] & mask);
     }
   }
+}
 
-  if (length > 0) {
-    drawBit = (1 << (length & 7)) - 1;
-    switch (color) {
-      case WHITE:   *bufferPtr |=  drawBit; break;
-      case BLACK:   *bufferPtr &= ~drawBit; break;
-      case INVERSE: *bufferPtr ^=  drawBit; break;
-    }
+void OLEDDisplay::beginOffscreen(uint8_t *target) {
+  if (this->recordList) {
+    this->recordList->invalidate();
+    return;
   }
+  memset(target, 0, DISPLAY_BUFFER_SIZE);
+  this->screenBuffer = this->buffer;
+  this->buffer = target;
+  this->bufferFirstPage = 0;
+  this->clipMinX = 0;
+  this->clipMaxX = DISPLAY_WIDTH - 1;
+  this->clipMinY = 0;
+  this->clipMaxY = DISPLAY_HEIGHT - 1;
 }
 
-void OLEDDisplay::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress) {
-  uint16_t radius = height / 2;
-  uint16_t xRadius = x + radius;
-  uint16_t yRadius = y + radius;
-  uint16_t doubleRadius = 2 * radius;
-  uint16_t innerRadius = radius - 2;
+void OLEDDisplay::endOffscreen(void) {
+  if (this->recordList) return;
+  this->buffer = this->screenBuffer;
+  this->screenBuffer = NULL;
+  this->bufferFirstPage = this->bandFirstPage;
+  resetClip();
+}
 
-  setColor(WHITE);
-  drawCircleQuads(xRadius, yRadius, radius, 0b00000110);
-  drawHorizontalLine(xRadius, y, width - doubleRadius + 1);
-  drawHorizontalLine(xRadius, y + height, width - doubleRadius + 1);
-  drawCircleQuads(x + width - radius, yRadius, radius, 0b00001001);
+void OLEDDisplay::beginRecording(OLEDDisplayList *list) {
+  list->clear();
+
+  // A replay starts with the state the recording started with
+  list->put8(LIST_COLOR);
+  list->put8(this->color);
+  list->put8(LIST_ALIGNMENT);
+  list->put8(this->textAlignment);
+  list->put8(LIST_FONT);
+  list->putRef(this->fontData);
+
+  // isVisible() answers for the whole screen, not just the band
+  this->recordClip[0]   = this->clipMinX;
+  this->recordClip[1]   = this->clipMinY;
+  this->recordClip[2]   = this->clipMaxX;
+  this->recordClip[3]   = this->clipMaxY;
+  this->recordClipDepth = this->clipDepth;
+  this->clipMinX = 0;
+  this->clipMinY = 0;
+  this->clipMaxX = DISPLAY_WIDTH - 1;
+  this->clipMaxY = DISPLAY_HEIGHT - 1;
+
+  this->recordList = list;
+}
 
-  uint16_t maxProgressWidth = (width - doubleRadius - 1) * progress / 100;
+bool OLEDDisplay::endRecording(void) {
+  if (!this->recordList) return false;
 
-  fillCircle(xRadius, yRadius, innerRadius);
-  fillRect(xRadius + 1, y + 2, maxProgressWidth, height - 3);
-  fillCircle(xRadius + maxProgressWidth, yRadius, innerRadius);
+  this->clipMinX  = this->recordClip[0];
+  this->clipMinY  = this->recordClip[1];
+  this->clipMaxX  = this->recordClip[2];
+  this->clipMaxY  = this->recordClip[3];
+  this->clipDepth = this->recordClipDepth;
+
+  bool valid = this->recordList->isValid();
+  this->recordList = NULL;
+  return valid;
 }
 
-void OLEDDisplay::drawFastImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *image) {
-  drawInternal(xMove, yMove, width, height, image, 0, 0);
+void OLEDDisplay::recordCommand(uint8_t op, const int16_t *args, uint8_t count) {
+  this->recordList->put8(op);
+  for (uint8_t i = 0; i < count; i++) {
+    this->recordList->put16(args[i]);
+  }
+}
+
+void OLEDDisplay::replay(OLEDDisplayList *list, int16_t x, int16_t y) {
+  if (!list->isValid()) return;
+
+  // Pushed clips that have to be popped again, one bit per level
+  uint16_t pushed = 0;
+  int16_t args[5];
+  uint16_t length;
+  const char *text;
+  const void *ref;
+
+  uint16_t pos = 0;
+  while (pos < list->getLength()) {
+    uint8_t op = list->get8(pos);
+    uint8_t count = 0;
+    switch (op) {
+      case LIST_PIXEL:            count = 2; break;
+      case LIST_STRING:           count = 2; break;
+      case LIST_CIRCLE:           count = 3; break;
+      case LIST_FILL_CIRCLE:      count = 3; break;
+      case LIST_STRING_MAX_WIDTH: count = 3; break;
+      case LIST_STRING_LINE:      count = 3; break;
+      case LIST_POP_CLIP:         count = 0; break;
+      case LIST_PROGRESS_BAR:     count = 5; break;
+      case LIST_COLOR:
+      case LIST_ALIGNMENT:
+      case LIST_FONT:             count = 0; break;
+      default:                    count = 4; break;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+      args[i] = list->get16(pos);
+    }
+    // Every command starts with a position, a line has two
+    if (count >= 2) {
+      args[0] += x;
+      args[1] += y;
+    }
+
+    switch (op) {
+      case LIST_COLOR:            setColor((OLEDDISPLAY_COLOR) list->get8(pos)); break;
+      case LIST_ALIGNMENT:        setTextAlignment((OLEDDISPLAY_TEXT_ALIGNMENT) list->get8(pos)); break;
+      case LIST_FONT:             setFont((const char *) list->getRef(pos)); break;
+      case LIST_PIXEL:            setPixel(args[0], args[1]); break;
+      case LIST_LINE:             drawLine(args[0], args[1], args[2] + x, args[3] + y); break;
+      case LIST_RECT:             drawRect(args[0], args[1], args[2], args[3]); break;
+      case LIST_FILL_RECT:        fillRect(args[0], args[1], args[2], args[3]); break;
+      case LIST_CIRCLE:           drawCircle(args[0], args[1], args[2]); break;
+      case LIST_CIRCLE_QUADS:     drawCircleQuads(args[0], args[1], args[2], args[3]); break;
+      case LIST_FILL_CIRCLE:      fillCircle(args[0], args[1], args[2]); break;
+      case LIST_PROGRESS_BAR:     drawProgressBar(args[0], args[1], args[2], args[3], args[4]); break;
+      case LIST_FAST_IMAGE:       drawFastImage(args[0], args[1], args[2], args[3], (const char *) list->getRef(pos)); break;
+      case LIST_PACKED_SPRITE:    drawPackedSprite(args[0], args[1], args[2], args[3], (const uint8_t *) list->getRef(pos)); break;
+      case LIST_XBM:              drawXbm(args[0], args[1], args[2], args[3], (const char *) list->getRef(pos)); break;
+      case LIST_SPRITE:
+        ref = list->getRef(pos);
+        drawSprite(args[0], args[1], args[2], args[3], (const uint8_t *) ref, (const uint8_t *) list->getRef(pos));
+        break;
+      case LIST_STRING:
+        text = list->getText(pos, &length);
+        drawString(args[0], args[1], text, length);
+        break;
+      case LIST_STRING_MAX_WIDTH:
+        text = list->getText(pos, &length);
+        drawStringMaxWidth(args[0], args[1], args[2], text, length);
+        break;
+      case LIST_STRING_LINE:
+        text = list->getText(pos, &length);
+        drawStringInternal(args[0], args[1], text, length, args[2]);
+        break;
+      case LIST_PUSH_CLIP:
+        pushed = (pushed << 1) | pushClip(args[0], args[1], args[2], args[3]);
+        break;
+      case LIST_POP_CLIP:
+        if (pushed & 1) popClip();
+        pushed >>= 1;
+        break;
+    }
+  }
+
+  // A list that pushed more than it popped
+  for (; pushed; pushed >>= 1) {
+    if (pushed & 1) popClip();
+  }
 }
 
 void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *xbm) {
-  int16_t widthInXbm = (width + 7) / 8;
-  uint8_t data;
-
-  for(int16_t y = 0; y < height; y++) {
-    for(int16_t x = 0; x < width; x++ ) {
-      if (x & 7) {
-        data >>= 1; // Move a bit
-      } else {  // Read new data every 8 bit
-        data = pgm_read_byte(xbm + (x / 8) + y * widthInXbm);
-      }
-      // if there is a bit draw it
-      if (data & 0x01) {
-        setPixel(xMove + x, yMove + y);
-      }
+  if (this->recordList) {
+    int16_t args[] = {xMove, yMove, width, height};
+    recordCommand(LIST_XBM, args, 4);
+    this->recordList->putRef(xbm);
+    return;
+  }
+  SpriteBlit blit;
+  if (!clipSprite(blit, xMove, yMove, width, height)) return;
+  blit.data = (const uint8_t *) xbm;
+
+  switch (this->color) {
+    case WHITE:   blitXbm<WHITE>(blit); break;
+    case BLACK:   blitXbm<BLACK>(blit); break;
+    case INVERSE: blitXbm<INVERSE>(blit); break;
+  }
+}
+
+void OLEDDisplay::drawSprite(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *sprite, const uint8_t *mask) {
+  if (this->recordList) {
+    int16_t args[] = {xMove, yMove, width, height};
+    recordCommand(LIST_SPRITE, args, 4);
+    this->recordList->putRef(sprite);
+    this->recordList->putRef(mask);
+    return;
+  }
+  SpriteBlit blit;
+  if (!clipSprite(blit, xMove, yMove, width, height)) return;
+  blit.data = sprite;
+  blit.mask = mask;
+
+  if (mask) {
+    switch (this->color) {
+      case WHITE:   blitSprite<WHITE,   true>(blit); break;
+      case BLACK:   blitSprite<BLACK,   true>(blit); break;
+      case INVERSE: blitSprite<INVERSE, true>(blit); break;
+    }
+  } else {
+    switch (this->color) {
+      case WHITE:   blitSprite<WHITE,   false>(blit); break;
+      case BLACK:   blitSprite<BLACK,   false>(blit); break;
+      case INVERSE: blitSprite<INVERSE, false>(blit); break;
     }
   }
 }
 
-void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth) {
-  uint8_t textHeight       = pgm_read_byte(fontData + HEIGHT_POS);
-  uint8_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
-  uint16_t sizeOfJumpTable = pgm_read_byte(fontData + CHAR_NUM_POS)  * JUMPTABLE_BYTES;
+bool OLEDDisplay::clipSprite(SpriteBlit &blit, int16_t xMove, int16_t yMove, int16_t width, int16_t height) {
+  if (!isVisible(xMove, yMove, width, height)) return false;
+
+  blit.buffer      = buffer;
+  blit.mask        = NULL;
+  blit.width       = width;
+  blit.xMove       = xMove;
+  blit.yMove       = yMove;
+  blit.firstColumn = max(clipMinX - xMove, 0);
+  blit.lastColumn  = min(width - 1, clipMaxX - xMove);
+  blit.firstRow    = max(clipMinY - yMove, 0);
+  blit.lastRow     = min(height - 1, clipMaxY - yMove);
+  blit.clipMinY    = clipMinY;
+  blit.clipMaxY    = clipMaxY;
+  blit.bufferFirstPage = bufferFirstPage;
+
+  markDirty(xMove + blit.firstColumn, xMove + blit.lastColumn,
+            (yMove + blit.firstRow) >> 3, (yMove + blit.lastRow) >> 3);
+  return true;
+}
 
-  uint8_t cursorX         = 0;
-  uint8_t cursorY         = 0;
+void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, uint16_t textWidth) {
+  uint8_t textHeight       = fontHeight();
+  uint8_t firstChar        = fontFirstChar();
+  bool packed              = fontPacked();
+
+  uint16_t cursorX        = 0;
+  uint16_t cursorY        = 0;
 
   switch (textAlignment) {
     case TEXT_ALIGN_CENTER_BOTH:
@@ -390,29 +1087,46 @@ void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char* text, u
       break;
   }
 
-  // Don't draw anything if it is not on the screen.
-  if (xMove + textWidth  < 0 || xMove > DISPLAY_WIDTH ) {return;}
-  if (yMove + textHeight < 0 || yMove > DISPLAY_HEIGHT) {return;}
+  // Don't draw anything if it is outside of the clip (e.g. the band)
+  if (xMove + textWidth  < clipMinX || xMove > clipMaxX) {return;}
+  if (yMove + textHeight < clipMinY || yMove > clipMaxY) {return;}
+
+  // Draw the whole run with a single blit if it is (or can be) cached
+  if (textCache.isEnabled()) {
+    uint16_t runWidth;
+    const uint8_t *run = textCache.lookup(fontData, text, textLength, &runWidth);
+    if (run == NULL) {
+      run = renderTextRun(text, textLength, &runWidth);
+    }
+    if (run != NULL) {
+      drawInternal(xMove, yMove, runWidth, textHeight, (const char *) run, 0, 0);
+      return;
+    }
+  }
 
+  uint16_t dataStart = fontDataStart();
   for (uint16_t j = 0; j < textLength; j++) {
     int16_t xPos = xMove + cursorX;
     int16_t yPos = yMove + cursorY;
 
-    byte code = text[j];
+    // The glyphs that follow are right of the clip as well
+    if (xPos > clipMaxX) break;
+
+    byte code = utf8ascii(text, j);
     if (code >= firstChar) {
       byte charCode = code - firstChar;
+      byte currentCharWidth = charWidth(charCode);
 
-      // 4 Bytes per char code
-      byte msbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES );                  // MSB  \ JumpAddress
-      byte lsbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_LSB);   // LSB /
-      byte charByteSize     = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_SIZE);  // Size
-      byte currentCharWidth = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_WIDTH); // Width
-
-      // Test if the char is drawable
-      if (!(msbJumpToChar == 255 && lsbJumpToChar == 255)) {
-        // Get the position of the char data
-        uint16_t charDataPosition = JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
-        drawInternal(xPos, yPos, currentCharWidth, textHeight, fontData, charDataPosition, charByteSize);
+      // Glyphs left of the clip only move the cursor
+      if (xPos + currentCharWidth <= clipMinX) {
+        cursorX += currentCharWidth;
+        continue;
+      }
+
+      uint16_t charDataPosition;
+      uint8_t charByteSize;
+      if (getGlyph(charCode, dataStart, &charDataPosition, &charByteSize)) {
+        drawInternal(xPos, yPos, currentCharWidth, textHeight, fontData, charDataPosition, charByteSize, packed);
       }
 
       cursorX += currentCharWidth;
@@ -420,43 +1134,111 @@ void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char* text, u
   }
 }
 
+uint8_t* OLEDDisplay::renderTextRun(const char* text, uint16_t textLength, uint16_t *runWidth) {
+  uint8_t textHeight       = fontHeight();
+  uint8_t firstChar        = fontFirstChar();
+  uint16_t dataStart       = fontDataStart();
+  bool packed              = fontPacked();
+  uint8_t rasterHeight     = 1 + ((textHeight - 1) >> 3); // fast ceil(height / 8.0)
 
-void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, String strUser) {
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
-
-  // char* text must be freed!
-  char* text = utf8ascii(strUser);
-
-  uint16_t yOffset = 0;
-  // If the string should be centered vertically too
-  // we need to now how heigh the string is.
-  if (textAlignment == TEXT_ALIGN_CENTER_BOTH) {
-    uint16_t lb = 0;
-    // Find number of linebreaks in text
-    for (uint16_t i=0;text[i] != 0; i++) {
-      lb += (text[i] == 10);
+  uint16_t width = 0;
+  for (uint16_t j = 0; j < textLength; j++) {
+    byte code = utf8ascii(text, j);
+    if (code >= firstChar) {
+      width += charWidth(code - firstChar);
     }
-    // Calculate center
-    yOffset = (lb * lineHeight) / 2;
   }
 
-  uint16_t line = 0;
-  char* textPart = strtok(text,"\n");
-  while (textPart != NULL) {
-    uint16_t length = strlen(textPart);
-    drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, textPart, length, getStringWidth(textPart, length));
-    textPart = strtok(NULL, "\n");
-  }
-  free(text);
+  uint8_t *bitmap = textCache.insert(fontData, text, textLength, width, rasterHeight);
+  if (bitmap == NULL) return NULL;
+
+  // Glyphs are stored column by column just like the run bitmap,
+  // so every glyph is a single copy to its cursor position.
+  uint16_t cursorX = 0;
+  for (uint16_t j = 0; j < textLength; j++) {
+    byte code = utf8ascii(text, j);
+    if (code >= firstChar) {
+      byte currentCharWidth = charWidth(code - firstChar);
+      uint16_t charDataPosition;
+      uint8_t charByteSize;
+
+      if (getGlyph(code - firstChar, dataStart, &charDataPosition, &charByteSize)) {
+        if (packed) {
+          unpackGlyph(bitmap + cursorX * rasterHeight, fontData + charDataPosition, charByteSize, currentCharWidth, rasterHeight);
+        } else {
+          uint16_t bytes = min((uint16_t) charByteSize, (uint16_t) (currentCharWidth * rasterHeight));
+          memcpy_P(bitmap + cursorX * rasterHeight, fontData + charDataPosition, bytes);
+        }
+      }
+
+      cursorX += currentCharWidth;
+    }
+  }
+
+  *runWidth = width;
+  return bitmap;
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const char* text, uint16_t length) {
+  if (this->recordList) {
+    int16_t args[] = {xMove, yMove};
+    recordCommand(LIST_STRING, args, 2);
+    this->recordList->putText(text, length);
+    return;
+  }
+
+  uint16_t lineHeight = fontHeight();
+
+  uint16_t yOffset = 0;
+  // If the string should be centered vertically too
+  // we need to now how heigh the string is.
+  if (textAlignment == TEXT_ALIGN_CENTER_BOTH) {
+    uint16_t lb = 0;
+    // Find number of linebreaks in text
+    for (uint16_t i = 0; i < length; i++) {
+      lb += (pgm_read_byte(text + i) == 10);
+    }
+    // Calculate center
+    yOffset = (lb * lineHeight) / 2;
+  }
+
+  // Draw every non empty line, the text itself is never copied
+  uint16_t line = 0;
+  uint16_t lineStart = 0;
+  for (uint16_t i = 0; i <= length; i++) {
+    if (i == length || pgm_read_byte(text + i) == 10) {
+      if (i > lineStart) {
+        uint16_t lineLength = i - lineStart;
+        drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, text + lineStart, lineLength, getStringWidth(text + lineStart, lineLength));
+      }
+      lineStart = i + 1;
+    }
+  }
 }
 
-void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, String strUser) {
-  uint16_t firstChar  = pgm_read_byte(fontData + FIRST_CHAR_POS);
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const char* text) {
+  drawString(xMove, yMove, text, strlen(text));
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const __FlashStringHelper* text) {
+  drawString(xMove, yMove, (const char*) text, strlen_P((const char*) text));
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const String &text) {
+  drawString(xMove, yMove, text.c_str(), text.length());
+}
 
-  char* text = utf8ascii(strUser);
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const char* text, uint16_t length) {
+  if (this->recordList) {
+    int16_t args[] = {xMove, yMove, (int16_t) maxLineWidth};
+    recordCommand(LIST_STRING_MAX_WIDTH, args, 3);
+    this->recordList->putText(text, length);
+    return;
+  }
+
+  uint16_t firstChar  = fontFirstChar();
+  uint16_t lineHeight = fontHeight();
 
-  uint16_t length = strlen(text);
   uint16_t lastDrawnPos = 0;
   uint16_t lineNumber = 0;
   uint16_t strWidth = 0;
@@ -465,10 +1247,13 @@ void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxL
   uint16_t widthAtBreakpoint = 0;
 
   for (uint16_t i = 0; i < length; i++) {
-    strWidth += pgm_read_byte(fontData + JUMPTABLE_START + (text[i] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+    byte code = utf8ascii(text, i);
+    if (code < firstChar) continue;
+
+    strWidth += charWidth(code - firstChar);
 
     // Always try to break on a space or dash
-    if (text[i] == ' ' || text[i]== '-') {
+    if (code == ' ' || code == '-') {
       preferredBreakpoint = i;
       widthAtBreakpoint = strWidth;
     }
@@ -492,75 +1277,751 @@ void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxL
   if (lastDrawnPos < length) {
     drawStringInternal(xMove, yMove + lineNumber * lineHeight , &text[lastDrawnPos], length - lastDrawnPos, getStringWidth(&text[lastDrawnPos], length - lastDrawnPos));
   }
+}
 
-  free(text);
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const char* text) {
+  drawStringMaxWidth(xMove, yMove, maxLineWidth, text, strlen(text));
+}
+
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const __FlashStringHelper* text) {
+  drawStringMaxWidth(xMove, yMove, maxLineWidth, (const char*) text, strlen_P((const char*) text));
+}
+
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const String &text) {
+  drawStringMaxWidth(xMove, yMove, maxLineWidth, text.c_str(), text.length());
 }
 
 uint16_t OLEDDisplay::getStringWidth(const char* text, uint16_t length) {
-  uint16_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
+  uint16_t firstChar        = fontFirstChar();
 
   uint16_t stringWidth = 0;
   uint16_t maxWidth = 0;
 
-  while (length--) {
-    stringWidth += pgm_read_byte(fontData + JUMPTABLE_START + (text[length] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
-    if (text[length] == 10) {
+  for (uint16_t i = 0; i < length; i++) {
+    byte code = utf8ascii(text, i);
+    if (code == 10) {
       maxWidth = max(maxWidth, stringWidth);
       stringWidth = 0;
+    } else if (code >= firstChar) {
+      stringWidth += charWidth(code - firstChar);
     }
   }
 
   return max(maxWidth, stringWidth);
 }
 
-uint16_t OLEDDisplay::getStringWidth(String strUser) {
-  char* text = utf8ascii(strUser);
-  uint16_t length = strlen(text);
-  uint16_t width = getStringWidth(text, length);
-  free(text);
-  return width;
+uint16_t OLEDDisplay::getStringWidth(const char* text) {
+  return getStringWidth(text, strlen(text));
+}
+
+uint16_t OLEDDisplay::getStringWidth(const __FlashStringHelper* text) {
+  return getStringWidth((const char*) text, strlen_P((const char*) text));
+}
+
+uint16_t OLEDDisplay::getStringWidth(const String &text) {
+  return getStringWidth(text.c_str(), text.length());
+}
+
+void OLEDDisplay::layoutText(OLEDDisplayTextLayout *layout, const char* text, uint16_t maxLineWidth) {
+  layoutText(layout, text, strlen(text), maxLineWidth);
+}
+
+void OLEDDisplay::layoutText(OLEDDisplayTextLayout *layout, const char* text, uint16_t length, uint16_t maxLineWidth) {
+  uint16_t firstChar = fontFirstChar();
+
+  layout->text         = text;
+  layout->fontData     = fontData;
+  layout->lineHeight   = fontHeight();
+  layout->width        = 0;
+  layout->centerOffset = 0;
+  layout->rows         = 0;
+  layout->lineCount    = 0;
+  layout->truncated    = false;
+
+  if (maxLineWidth == 0) {
+    // Same lines as drawString(), empty lines take no row
+    uint16_t breaks = 0;
+    uint16_t lineStart = 0;
+    uint16_t lineWidth = 0;
+    uint8_t row = 0;
+    for (uint16_t i = 0; i <= length; i++) {
+      if (i == length || pgm_read_byte(text + i) == 10) {
+        if (i > lineStart) {
+          layout->addLine(lineStart, i - lineStart, lineWidth, row++);
+        }
+        breaks += i < length;
+        lineStart = i + 1;
+        lineWidth = 0;
+      } else {
+        byte code = utf8ascii(text + lineStart, i - lineStart);
+        if (code >= firstChar) {
+          lineWidth += charWidth(code - firstChar);
+        }
+      }
+    }
+    layout->centerOffset = (breaks * layout->lineHeight) / 2;
+    return;
+  }
+
+  // Same lines as drawStringMaxWidth(), a newline ends the line as well
+  uint16_t lastDrawnPos = 0;
+  uint16_t strWidth = 0;
+  uint16_t preferredBreakpoint = 0;
+  uint16_t widthAtBreakpoint = 0;
+
+  for (uint16_t i = 0; i < length; i++) {
+    byte code = utf8ascii(text, i);
+    if (code == 10) {
+      layout->addLine(lastDrawnPos, i - lastDrawnPos, strWidth, layout->lineCount);
+      lastDrawnPos = i + 1;
+      strWidth = 0;
+      preferredBreakpoint = 0;
+      continue;
+    }
+    if (code < firstChar) continue;
+
+    strWidth += charWidth(code - firstChar);
+
+    if (code == ' ' || code == '-') {
+      preferredBreakpoint = i;
+      widthAtBreakpoint = strWidth;
+    }
+
+    if (strWidth >= maxLineWidth) {
+      if (preferredBreakpoint == 0) {
+        preferredBreakpoint = i;
+        widthAtBreakpoint = strWidth;
+      }
+      layout->addLine(lastDrawnPos, preferredBreakpoint - lastDrawnPos, widthAtBreakpoint, layout->lineCount);
+      lastDrawnPos = preferredBreakpoint + 1;
+      strWidth = strWidth - widthAtBreakpoint;
+      preferredBreakpoint = 0;
+    }
+  }
+
+  if (lastDrawnPos < length) {
+    layout->addLine(lastDrawnPos, length - lastDrawnPos, strWidth, layout->lineCount);
+  }
+  if (layout->rows > 0) {
+    layout->centerOffset = ((layout->rows - 1) * layout->lineHeight) / 2;
+  }
+}
+
+void OLEDDisplay::drawTextLayout(int16_t xMove, int16_t yMove, OLEDDisplayTextLayout *layout) {
+  if (layout->lineCount == 0) return;
+
+  const char *currentFont = this->fontData;
+  if (currentFont != layout->fontData) {
+    setFont(layout->fontData);
+  }
+
+  if (textAlignment == TEXT_ALIGN_CENTER_BOTH) {
+    yMove -= layout->centerOffset;
+  }
+  for (uint8_t i = 0; i < layout->lineCount; i++) {
+    const OLEDDisplayTextLine &line = layout->lines[i];
+    int16_t yPos = yMove + line.row * layout->lineHeight;
+    if (this->recordList) {
+      int16_t args[] = {xMove, yPos, (int16_t) line.width};
+      recordCommand(LIST_STRING_LINE, args, 3);
+      this->recordList->putText(layout->text + line.start, line.length);
+    } else {
+      drawStringInternal(xMove, yPos, layout->text + line.start, line.length, line.width);
+    }
+  }
+
+  if (currentFont != layout->fontData) {
+    setFont(currentFont);
+  }
+}
+
+OLEDDisplayRect OLEDDisplay::getTextLayoutBounds(int16_t xMove, int16_t yMove, OLEDDisplayTextLayout *layout) {
+  OLEDDisplayRect bounds = {xMove, yMove, (int16_t) layout->getWidth(), (int16_t) layout->getHeight()};
+  switch (textAlignment) {
+    case TEXT_ALIGN_CENTER_BOTH:
+      bounds.y -= layout->centerOffset + (layout->lineHeight >> 1);
+    // Fallthrough
+    case TEXT_ALIGN_CENTER:
+      bounds.x -= layout->width >> 1;
+      break;
+    case TEXT_ALIGN_RIGHT:
+      bounds.x -= layout->width;
+      break;
+    default:
+      break;
+  }
+  return bounds;
+}
+
+bool OLEDDisplay::setTextCache(uint16_t size) {
+  if (!this->textCache.setSize(size)) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setTextCache] Not enough memory to create text cache\n");
+    return false;
+  }
+  return true;
+}
+
+uint32_t OLEDDisplay::getTextCacheHits() {
+  return this->textCache.getHits();
+}
+
+uint32_t OLEDDisplay::getTextCacheMisses() {
+  return this->textCache.getMisses();
+}
+
+bool OLEDDisplay::setFontBudget(uint16_t size) {
+  this->hotFont = NULL;
+  if (!this->fontCache.setSize(size)) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setFontBudget] Not enough memory for the font budget\n");
+    return false;
+  }
+  return true;
+}
+
+bool OLEDDisplay::promoteFont(const char *fontData) {
+  const OLEDDisplayFont *font = this->fontCache.promote(fontData);
+  if (font == NULL) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][promoteFont] The font doesn't fit into the font budget\n");
+    return false;
+  }
+  if (this->fontData == fontData) {
+    this->hotFont = font;
+  }
+  return true;
+}
+
+bool OLEDDisplay::getGlyph(uint8_t charCode, uint16_t dataStart, uint16_t *position, uint8_t *size) {
+  if (this->hotFont) {
+    if (charCode >= this->hotFont->charCount || this->hotFont->offsets[charCode] == OLEDDISPLAY_NO_GLYPH) return false;
+    *position = this->hotFont->offsets[charCode];
+    *size     = this->hotFont->sizes[charCode];
+    return true;
+  }
+
+  if (charCode >= pgm_read_byte(fontData + CHAR_NUM_POS)) return false;
+  const char *jump   = fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES;
+  byte msbJumpToChar = pgm_read_byte(jump);                  // MSB  \ JumpAddress
+  byte lsbJumpToChar = pgm_read_byte(jump + JUMPTABLE_LSB);  // LSB /
+  // Test if the char is drawable
+  if (msbJumpToChar == 255 && lsbJumpToChar == 255) return false;
+  *position = dataStart + ((msbJumpToChar << 8) + lsbJumpToChar);
+  *size     = pgm_read_byte(jump + JUMPTABLE_SIZE);
+  return true;
 }
 
 void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment) {
+  if (this->recordList) {
+    this->recordList->put8(LIST_ALIGNMENT);
+    this->recordList->put8(textAlignment);
+  }
   this->textAlignment = textAlignment;
 }
 
 void OLEDDisplay::setFont(const char *fontData) {
+  if (this->recordList) {
+    this->recordList->put8(LIST_FONT);
+    this->recordList->putRef(fontData);
+  }
   this->fontData = fontData;
+  this->hotFont  = this->fontCache.find(fontData);
 }
 
 void OLEDDisplay::displayOn(void) {
+  if (this->panelOn == 1) {
+    this->suppressedCommands++;
+    return;
+  }
   sendCommand(DISPLAYON);
+  flushCommands();
+  this->panelOn = 1;
 }
 
 void OLEDDisplay::displayOff(void) {
+  if (this->panelOn == 0) {
+    this->suppressedCommands++;
+    return;
+  }
   sendCommand(DISPLAYOFF);
+  flushCommands();
+  this->panelOn = 0;
 }
 
 void OLEDDisplay::invertDisplay(void) {
+  if (this->panelInverted == 1) {
+    this->suppressedCommands++;
+    return;
+  }
   sendCommand(INVERTDISPLAY);
+  flushCommands();
+  this->panelInverted = 1;
 }
 
 void OLEDDisplay::normalDisplay(void) {
+  if (this->panelInverted == 0) {
+    this->suppressedCommands++;
+    return;
+  }
   sendCommand(NORMALDISPLAY);
+  flushCommands();
+  this->panelInverted = 0;
 }
 
 void OLEDDisplay::setContrast(char contrast) {
+  this->fading = false;
+  sendContrast(contrast);
+}
+
+void OLEDDisplay::sendContrast(uint8_t contrast) {
+  if (this->panelContrast == contrast) {
+    this->suppressedCommands++;
+    return;
+  }
   sendCommand(SETCONTRAST);
   sendCommand(contrast);
+  flushCommands();
+  this->panelContrast = contrast;
+}
+
+void OLEDDisplay::fadeContrast(uint8_t contrast, uint16_t time) {
+  if (this->fading ? this->fadeTo == contrast : this->panelContrast == contrast) return;
+  if (this->panelContrast < 0 || time == 0) {
+    setContrast(contrast);
+    return;
+  }
+  this->fading    = true;
+  this->fadeFrom  = this->panelContrast;
+  this->fadeTo    = contrast;
+  this->fadeTime  = time;
+  this->fadeStart = millis();
+}
+
+bool OLEDDisplay::stepFade(void) {
+  if (!this->fading) return false;
+
+  uint32_t elapsed = millis() - this->fadeStart;
+  uint8_t contrast = this->fadeTo;
+  if (elapsed < this->fadeTime) {
+    contrast = this->fadeFrom + ((int16_t) this->fadeTo - this->fadeFrom) * (int32_t) elapsed / this->fadeTime;
+  } else {
+    this->fading = false;
+  }
+  if (contrast != this->panelContrast) {
+    sendContrast(contrast);
+  }
+  return this->fading;
+}
+
+bool OLEDDisplay::isFading(void) {
+  return this->fading;
 }
 
 void OLEDDisplay::flipScreenVertically() {
+  if (this->panelFlipped == 1) {
+    this->suppressedCommands += 2;
+    return;
+  }
   sendCommand(SEGREMAP | 0x01);
   sendCommand(COMSCANDEC);           //Rotate screen 180 Deg
+  flushCommands();
+  this->panelFlipped = 1;
+}
+
+void OLEDDisplay::setStartLine(uint8_t line) {
+  line &= 0x3F;
+  if (this->panelStartLine == line) {
+    this->suppressedCommands++;
+    return;
+  }
+  this->panelStartLine = line;
+
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  // The rows must be in the display RAM before they are shown
+  if (this->pendingPages) {
+    this->pendingStartLine = line;
+    return;
+  }
+  #endif
+  sendCommand(SETSTARTLINE | line);
+  flushCommands();
 }
 
 void OLEDDisplay::clear(void) {
-  memset(buffer, 0, DISPLAY_BUFFER_SIZE);
+  // The ink ranges belong to the display buffer
+  if (this->screenBuffer) {
+    memset(buffer, 0, DISPLAY_BUFFER_SIZE);
+    return;
+  }
+
+  // Only the columns drawn since the last clear can hold set pixels
+  for (uint8_t page = bandFirstPage; page <= bandLastPage; page++) {
+    if (inkMinX[page] > inkMaxX[page]) continue;
+    #ifndef OLEDDISPLAY_BANDED
+    memset(pagePtr(page, inkMinX[page]), 0, inkMaxX[page] - inkMinX[page] + 1);
+    #endif
+    dirtyMinX[page] = min(dirtyMinX[page], inkMinX[page]);
+    dirtyMaxX[page] = max(dirtyMaxX[page], inkMaxX[page]);
+    inkMinX[page]   = DISPLAY_WIDTH;
+    inkMaxX[page]   = 0;
+  }
+
+  #ifdef OLEDDISPLAY_BANDED
+  // The band memory still holds the pages of the last band
+  memset(bandBuffer, 0, DISPLAY_WIDTH * OLEDDISPLAY_BAND_PAGES);
+  #endif
+}
+
+void OLEDDisplay::firstBand(void) {
+  #ifdef OLEDDISPLAY_BANDED
+  this->frameBytes = 0;
+  #ifdef OLEDDISPLAY_HASH_DIFF
+  checkRefresh();
+  #endif
+  beginBand(0);
+  #else
+  clear();
+  #endif
+}
+
+bool OLEDDisplay::nextBand(void) {
+  #ifdef OLEDDISPLAY_BANDED
+  sendBand();
+  // The last band stays selected, display() would send it again
+  if (this->bandLastPage == DISPLAY_HEIGHT / 8 - 1) return false;
+  beginBand(this->bandLastPage + 1);
+  return true;
+  #else
+  display();
+  return false;
+  #endif
+}
+
+bool OLEDDisplay::isVisible(int16_t x, int16_t y, int16_t width, int16_t height) {
+  // A pushed clip can be empty
+  return width > 0 && height > 0 &&
+         x <= clipMaxX && x + width > clipMinX && clipMinX <= clipMaxX &&
+         y <= clipMaxY && y + height > clipMinY && clipMinY <= clipMaxY;
+}
+
+bool OLEDDisplay::pushClip(int16_t x, int16_t y, int16_t width, int16_t height) {
+  if (this->recordList) {
+    int16_t args[] = {x, y, width, height};
+    recordCommand(LIST_PUSH_CLIP, args, 4);
+    return true;
+  }
+  if (this->clipDepth == OLEDDISPLAY_CLIP_DEPTH) return false;
+
+  int16_t *saved = this->clipStack[this->clipDepth++];
+  saved[0] = this->clipMinX;
+  saved[1] = this->clipMinY;
+  saved[2] = this->clipMaxX;
+  saved[3] = this->clipMaxY;
+
+  this->clipMinX = max(this->clipMinX, x);
+  this->clipMinY = max(this->clipMinY, y);
+  this->clipMaxX = min(this->clipMaxX, (int16_t) (x + width - 1));
+  this->clipMaxY = min(this->clipMaxY, (int16_t) (y + height - 1));
+  return true;
+}
+
+void OLEDDisplay::popClip(void) {
+  if (this->recordList) {
+    this->recordList->put8(LIST_POP_CLIP);
+    return;
+  }
+  if (this->clipDepth == 0) return;
+
+  int16_t *saved = this->clipStack[--this->clipDepth];
+  this->clipMinX = saved[0];
+  this->clipMinY = saved[1];
+  this->clipMaxX = saved[2];
+  this->clipMaxY = saved[3];
+}
+
+void OLEDDisplay::resetClip() {
+  this->clipMinX  = 0;
+  this->clipMaxX  = DISPLAY_WIDTH - 1;
+  this->clipMinY  = bandFirstPage * 8;
+  this->clipMaxY  = bandLastPage * 8 + 7;
+  this->clipDepth = 0;
+}
+
+#ifdef OLEDDISPLAY_BANDED
+void OLEDDisplay::beginBand(uint8_t page) {
+  this->bandFirstPage   = page;
+  this->bandLastPage    = min(page + OLEDDISPLAY_BAND_PAGES, DISPLAY_HEIGHT / 8) - 1;
+  this->buffer          = this->bandBuffer;
+  this->bufferFirstPage = page;
+  resetClip();
+  clear();
+}
+
+void OLEDDisplay::sendBand() {
+  for (uint8_t page = bandFirstPage; page <= bandLastPage; page++) {
+    #ifdef OLEDDISPLAY_HASH_DIFF
+    uint8_t x = 0, lastX;
+    while (nextChangedSpan(page, x, lastX, this->spanMergeGap)) {
+      sendData(page, x, pagePtr(page, x), lastX - x + 1);
+      x = lastX + 1;
+    }
+    #else
+    sendData(page, 0, pagePtr(page), DISPLAY_WIDTH);
+    #endif
+  }
+  yield();
+}
+#endif
+
+void OLEDDisplay::displayAsync(void) {
+  display();
+}
+
+bool OLEDDisplay::flush(void) {
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  if (this->pendingPages) {
+    return sendPendingPages(this->flushPages, this->flushBudget);
+  }
+  #endif
+  return false;
+}
+
+bool OLEDDisplay::isFlushing(void) {
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  return this->pendingPages != 0;
+  #else
+  return false;
+  #endif
+}
+
+void OLEDDisplay::setFlushStep(uint8_t pages, uint16_t budget) {
+  this->flushPages  = max(pages, (uint8_t) 1);
+  this->flushBudget = budget;
+}
+
+uint16_t OLEDDisplay::getFrameBytes(void) {
+  return this->frameBytes;
+}
+
+uint32_t OLEDDisplay::getSuppressedCommands(void) {
+  return this->suppressedCommands;
+}
+
+void OLEDDisplay::invalidate(void) {
+  memset(dirtyMinX, 0, sizeof(dirtyMinX));
+  memset(dirtyMaxX, DISPLAY_WIDTH - 1, sizeof(dirtyMaxX));
+  #ifdef OLEDDISPLAY_HASH_DIFF
+  this->refreshPages = 0xFF;
+  #endif
+}
+
+void inline OLEDDisplay::markDirty(int16_t firstColumn, int16_t lastColumn, int8_t firstPage, int8_t lastPage) {
+  for (int8_t page = firstPage; page <= lastPage; page++) {
+    if (firstColumn < dirtyMinX[page]) dirtyMinX[page] = firstColumn;
+    if (lastColumn  > dirtyMaxX[page]) dirtyMaxX[page] = lastColumn;
+    if (firstColumn < inkMinX[page])   inkMinX[page]   = firstColumn;
+    if (lastColumn  > inkMaxX[page])   inkMaxX[page]   = lastColumn;
+  }
+}
+
+#ifdef OLEDDISPLAY_HASH_DIFF
+bool OLEDDisplay::collectChanges(uint8_t &minBoundX, uint8_t &maxBoundX, uint8_t &minBoundY, uint8_t &maxBoundY) {
+  minBoundY = ~0;
+  maxBoundY = 0;
+  minBoundX = ~0;
+  maxBoundX = 0;
+
+  checkRefresh();
+  for (uint8_t y = 0; y < (DISPLAY_HEIGHT / 8); y++) {
+    uint8_t x = 0, lastX;
+    while (nextChangedSpan(y, x, lastX, DISPLAY_WIDTH)) {
+      minBoundY = _min(minBoundY, y);
+      maxBoundY = _max(maxBoundY, y);
+      minBoundX = _min(minBoundX, x);
+      maxBoundX = _max(maxBoundX, lastX);
+      x = lastX + 1;
+    }
+  }
+
+  return minBoundY <= maxBoundY;
+}
+
+bool OLEDDisplay::nextChangedSpan(uint8_t page, uint8_t &x, uint8_t &lastX, uint8_t mergeGap) {
+  uint8_t first = max(x, dirtyMinX[page]);
+  uint8_t end   = dirtyMaxX[page];
+  if (first > end) {
+    dirtyMinX[page] = DISPLAY_WIDTH;
+    dirtyMaxX[page] = 0;
+    this->refreshPages &= ~(1 << page);
+    return false;
+  }
+
+  uint8_t segment    = first / HASH_SEGMENT_WIDTH;
+  uint8_t endSegment = end / HASH_SEGMENT_WIDTH;
+  while (segment <= endSegment && !updateSegmentHash(page, segment)) segment++;
+
+  if (segment > endSegment) {
+    dirtyMinX[page] = DISPLAY_WIDTH;
+    dirtyMaxX[page] = 0;
+    this->refreshPages &= ~(1 << page);
+    return false;
+  }
+
+  uint8_t last = segment;
+  for (uint8_t i = segment + 1; i <= endSegment && (i - last - 1) * HASH_SEGMENT_WIDTH <= mergeGap; i++) {
+    if (updateSegmentHash(page, i)) last = i;
+  }
+
+  // Only the dirty columns of the segments can have changed
+  x     = max(first, (uint8_t) (segment * HASH_SEGMENT_WIDTH));
+  lastX = min(end, (uint8_t) (last * HASH_SEGMENT_WIDTH + HASH_SEGMENT_WIDTH - 1));
+  return true;
+}
+
+bool OLEDDisplay::updateSegmentHash(uint8_t page, uint8_t segment) {
+  // FNV-1a, the last segment of a page may be narrower
+  const uint8_t *data = pagePtr(page, segment * HASH_SEGMENT_WIDTH);
+  uint8_t width = min(HASH_SEGMENT_WIDTH, DISPLAY_WIDTH - segment * HASH_SEGMENT_WIDTH);
+  uint32_t hash = 2166136261UL;
+  for (uint8_t i = 0; i < width; i++) {
+    hash = (hash ^ data[i]) * 16777619UL;
+  }
+
+  bool changed = hash != this->segmentHash[page][segment] || (this->refreshPages & (1 << page));
+  this->segmentHash[page][segment] = hash;
+  return changed;
+}
+
+void OLEDDisplay::checkRefresh() {
+  if (millis() - this->lastRefresh < OLEDDISPLAY_HASH_REFRESH * 1000UL) return;
+  this->lastRefresh = millis();
+  invalidate();
+}
+
+void OLEDDisplay::sendChangedSpans() {
+  this->frameBytes = 0;
+  checkRefresh();
+  for (uint8_t page = 0; page < (DISPLAY_HEIGHT / 8); page++) {
+    uint8_t x = 0, lastX;
+    while (nextChangedSpan(page, x, lastX, this->spanMergeGap)) {
+      sendData(page, x, buffer + page * DISPLAY_WIDTH + x, lastX - x + 1);
+      x = lastX + 1;
+    }
+    yield();
+  }
+}
+#endif
+
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+bool OLEDDisplay::collectChanges(uint8_t &minBoundX, uint8_t &maxBoundX, uint8_t &minBoundY, uint8_t &maxBoundY) {
+  minBoundY = ~0;
+  maxBoundY = 0;
+  minBoundX = ~0;
+  maxBoundX = 0;
+
+  for (uint8_t y = 0; y < (DISPLAY_HEIGHT / 8); y++) {
+    if (dirtyMinX[y] > dirtyMaxX[y]) continue;
+    for (uint8_t x = dirtyMinX[y]; x <= dirtyMaxX[y]; x++) {
+      uint16_t pos = x + y * DISPLAY_WIDTH;
+      if (buffer[pos] != buffer_back[pos]) {
+        minBoundY = _min(minBoundY, y);
+        maxBoundY = _max(maxBoundY, y);
+        minBoundX = _min(minBoundX, x);
+        maxBoundX = _max(maxBoundX, x);
+        buffer_back[pos] = buffer[pos];
+      }
+    }
+    dirtyMinX[y] = DISPLAY_WIDTH;
+    dirtyMaxX[y] = 0;
+  }
+
+  return minBoundY <= maxBoundY;
+}
+
+bool OLEDDisplay::nextChangedSpan(uint8_t page, uint8_t &x, uint8_t &lastX, uint8_t mergeGap) {
+  uint8_t *front = buffer + page * DISPLAY_WIDTH;
+  uint8_t *back  = buffer_back + page * DISPLAY_WIDTH;
+  uint8_t first  = max(x, dirtyMinX[page]);
+  uint8_t end    = dirtyMaxX[page];
+
+  while (first <= end && front[first] == back[first]) first++;
+
+  if (first > end) {
+    dirtyMinX[page] = DISPLAY_WIDTH;
+    dirtyMaxX[page] = 0;
+    return false;
+  }
+
+  uint8_t last = first;
+  for (uint8_t i = first + 1; i <= end && i - last - 1 <= mergeGap; i++) {
+    if (front[i] != back[i]) last = i;
+  }
+
+  memcpy(back + first, front + first, last - first + 1);
+  x     = first;
+  lastX = last;
+  return true;
+}
+
+void OLEDDisplay::takeSnapshot() {
+  // A new frame starts counting unless it joins one still in flight
+  if (!this->pendingPages) this->frameBytes = 0;
+
+  for (uint8_t page = 0; page < (DISPLAY_HEIGHT / 8); page++) {
+    uint8_t x = 0, lastX;
+    while (nextChangedSpan(page, x, lastX, 0)) {
+      for (; x <= lastX; x++) {
+        this->pendingColumns[page][x >> 3] |= 1 << (x & 7);
+      }
+      this->pendingPages |= 1 << page;
+    }
+  }
 }
 
+bool OLEDDisplay::sendPendingPages(uint8_t pages, uint16_t budget) {
+  uint32_t start = micros();
+
+  for (uint8_t page = 0; page < (DISPLAY_HEIGHT / 8) && this->pendingPages; page++) {
+    if (!(this->pendingPages & (1 << page))) continue;
+
+    // Join the pending columns into runs, bridging small gaps
+    uint8_t *columns    = this->pendingColumns[page];
+    uint8_t *pageBuffer = this->buffer_back + page * DISPLAY_WIDTH;
+    int16_t first = -1, last = -1;
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+      if (!(columns[x >> 3] & (1 << (x & 7)))) continue;
+      if (first >= 0 && x - last - 1 > this->spanMergeGap) {
+        sendData(page, first, pageBuffer + first, last - first + 1);
+        first = -1;
+      }
+      if (first < 0) first = x;
+      last = x;
+    }
+    if (first >= 0) {
+      sendData(page, first, pageBuffer + first, last - first + 1);
+    }
+
+    memset(columns, 0, sizeof(this->pendingColumns[page]));
+    this->pendingPages &= ~(1 << page);
+    yield();
+
+    if (budget ? (uint32_t) (micros() - start) >= budget : --pages == 0) break;
+  }
+
+  if (!this->pendingPages && this->pendingStartLine >= 0) {
+    sendCommand(SETSTARTLINE | this->pendingStartLine);
+    flushCommands();
+    this->pendingStartLine = -1;
+  }
+
+  return this->pendingPages != 0;
+}
+#endif
+
 void OLEDDisplay::drawLogBuffer(uint16_t xMove, uint16_t yMove) {
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+  if (this->recordList) {
+    this->recordList->invalidate();
+    return;
+  }
+  uint16_t lineHeight = fontHeight();
   // Always align left
   setTextAlignment(TEXT_ALIGN_LEFT);
 
@@ -617,7 +2078,7 @@ size_t OLEDDisplay::write(uint8_t c) {
 
     // Can we write to the buffer?
     if (bufferNotFull && maxLineNotReached) {
-      this->logBuffer[logBufferFilled] = utf8ascii(c);
+      this->logBuffer[logBufferFilled] = c;
       this->logBufferFilled++;
       // Keep track of lines written
       if (c == 10) this->logBufferLine++;
@@ -670,7 +2131,7 @@ void OLEDDisplay::sendInitCommands(void) {
   sendCommand(SETDISPLAYCLOCKDIV);
   sendCommand(0xF0); // Increase speed of the display max ~96Hz
   sendCommand(SETMULTIPLEX);
-  sendCommand(0x3F);
+  sendCommand(DISPLAY_HEIGHT - 1);
   sendCommand(SETDISPLAYOFFSET);
   sendCommand(0x00);
   sendCommand(SETSTARTLINE);
@@ -681,7 +2142,7 @@ void OLEDDisplay::sendInitCommands(void) {
   sendCommand(SEGREMAP);
   sendCommand(COMSCANINC);
   sendCommand(SETCOMPINS);
-  sendCommand(0x12);
+  sendCommand(DISPLAY_COM_PINS);
   sendCommand(SETCONTRAST);
   sendCommand(0xCF);
   sendCommand(SETPRECHARGE);
@@ -690,87 +2151,97 @@ void OLEDDisplay::sendInitCommands(void) {
   sendCommand(NORMALDISPLAY);
   sendCommand(0x2e);            // stop scroll
   sendCommand(DISPLAYON);
+  flushCommands();
+
+  this->panelContrast  = 0xCF;
+  this->panelOn        = 1;
+  this->panelInverted  = 0;
+  this->panelFlipped   = 0;
+  this->panelStartLine = 0;
+  this->fading         = false;
 }
 
-void inline OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *data, uint16_t offset, uint16_t bytesInData) {
-  if (width < 0 || height < 0) return;
-  if (yMove + height < 0 || yMove > DISPLAY_HEIGHT)  return;
-  if (xMove + width  < 0 || xMove > DISPLAY_WIDTH)   return;
+void inline OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *data, uint16_t offset, uint16_t bytesInData, bool packed) {
+  if (!isVisible(xMove, yMove, width, height)) return;
 
   uint8_t  rasterHeight = 1 + ((height - 1) >> 3); // fast ceil(height / 8.0)
-  int8_t   yOffset      = yMove & 7;
-
-  bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
-
-  int16_t initYMove   = yMove;
-  int8_t  initYOffset = yOffset;
-
-
-  for (uint16_t i = 0; i < bytesInData; i++) {
-
-    // Reset if next horizontal drawing phase is started.
-    if ( i % rasterHeight == 0) {
-      yMove   = initYMove;
-      yOffset = initYOffset;
-    }
-
-    byte currentByte = pgm_read_byte(data + offset + i);
-
-    int16_t xPos = xMove + (i / rasterHeight);
-    int16_t yPos = ((yMove >> 3) + (i % rasterHeight)) * DISPLAY_WIDTH;
-
-    int16_t yScreenPos = yMove + yOffset;
-    int16_t dataPos    = xPos  + yPos;
-
-    if (dataPos >=  0  && dataPos < DISPLAY_BUFFER_SIZE &&
-        xPos    >=  0  && xPos    < DISPLAY_WIDTH ) {
-
-      if (yOffset >= 0) {
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte << yOffset; break;
-          case BLACK:   buffer[dataPos] &= ~(currentByte << yOffset); break;
-          case INVERSE: buffer[dataPos] ^= currentByte << yOffset; break;
-        }
-        if (dataPos < (DISPLAY_BUFFER_SIZE - DISPLAY_WIDTH)) {
-          switch (this->color) {
-            case WHITE:   buffer[dataPos + DISPLAY_WIDTH] |= currentByte >> (8 - yOffset); break;
-            case BLACK:   buffer[dataPos + DISPLAY_WIDTH] &= ~(currentByte >> (8 - yOffset)); break;
-            case INVERSE: buffer[dataPos + DISPLAY_WIDTH] ^= currentByte >> (8 - yOffset); break;
-          }
-        }
-      } else {
-        // Make new offset position
-        yOffset = -yOffset;
-
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte >> yOffset; break;
-          case BLACK:   buffer[dataPos] &= ~(currentByte >> yOffset); break;
-          case INVERSE: buffer[dataPos] ^= currentByte >> yOffset; break;
-        }
-
-        // Prepare for next iteration by moving one block up
-        yMove -= 8;
-
-        // and setting the new yOffset
-        yOffset = 8 - yOffset;
+  uint8_t  yOffset      = yMove & 7;
+  int8_t   firstPage    = yMove >> 3;
+  int8_t   clipTopPage  = clipMinY >> 3;
+  int8_t   clipLastPage = clipMaxY >> 3;
+
+  // Packed data decodes to width * rasterHeight bytes, `bytesInData` is
+  // the size of the stream then (0 if it isn't known)
+  uint16_t packedSize = packed ? bytesInData : 0;
+  bytesInData = bytesInData == 0 || packed ? width * rasterHeight : bytesInData;
+
+  // Clip the whole glyph once. Columns left of the clip are skipped,
+  // columns right of it or past the end of the data are never read.
+  int16_t firstColumn = max(clipMinX - xMove, 0);
+  int16_t lastColumn  = min((int16_t) ((bytesInData + rasterHeight - 1) / rasterHeight), width);
+  lastColumn          = min(lastColumn, (int16_t) (clipMaxX + 1 - xMove));
+
+  // An unaligned raster row also touches the page below it, so one
+  // row above the clip can still be (partially) visible.
+  int8_t firstRow = yOffset ? clipTopPage - firstPage - 1 : clipTopPage - firstPage;
+  firstRow        = max(firstRow, (int8_t) 0);
+  int8_t lastRow  = min((int16_t) rasterHeight, (int16_t) (clipLastPage + 1 - firstPage));
+
+  if (firstColumn >= lastColumn || firstRow >= lastRow) return;
+
+  // Unaligned rows spill into the page below
+  markDirty(xMove + firstColumn, xMove + lastColumn - 1,
+            max(firstPage + firstRow, (int) clipTopPage),
+            min(firstPage + lastRow - (yOffset ? 0 : 1), (int) clipLastPage));
+
+  GlyphBlit blit = {
+    buffer, data + offset, rasterHeight, bytesInData,
+    xMove, firstPage, yOffset,
+    firstColumn, lastColumn, firstRow, lastRow,
+    clipMinY, clipMaxY, width, bufferFirstPage
+  };
+
+  if (packed) {
+    blit.bytesInData = packedSize;
+    if (yOffset == 0) {
+      switch (this->color) {
+        case WHITE:   blitPackedGlyph<WHITE,   true>(blit); break;
+        case BLACK:   blitPackedGlyph<BLACK,   true>(blit); break;
+        case INVERSE: blitPackedGlyph<INVERSE, true>(blit); break;
       }
-
-      yield();
+    } else {
+      switch (this->color) {
+        case WHITE:   blitPackedGlyph<WHITE,   false>(blit); break;
+        case BLACK:   blitPackedGlyph<BLACK,   false>(blit); break;
+        case INVERSE: blitPackedGlyph<INVERSE, false>(blit); break;
+      }
+    }
+  } else if (yOffset == 0) {
+    switch (this->color) {
+      case WHITE:   blitGlyph<WHITE,   true>(blit); break;
+      case BLACK:   blitGlyph<BLACK,   true>(blit); break;
+      case INVERSE: blitGlyph<INVERSE, true>(blit); break;
+    }
+  } else {
+    switch (this->color) {
+      case WHITE:   blitGlyph<WHITE,   false>(blit); break;
+      case BLACK:   blitGlyph<BLACK,   false>(blit); break;
+      case INVERSE: blitGlyph<INVERSE, false>(blit); break;
     }
   }
 }
 
 // Code form http://playground.arduino.cc/Main/Utf8ascii
-uint8_t OLEDDisplay::utf8ascii(byte ascii) {
-  static uint8_t LASTCHAR;
+// Instead of remembering the last byte in a static variable the decoder
+// looks back one byte, which makes it safe to use from any position.
+uint8_t OLEDDisplay::utf8ascii(const char* text, uint16_t pos) {
+  uint8_t ascii = pgm_read_byte(text + pos);
 
   if ( ascii < 128 ) { // Standard ASCII-set 0..0x7F handling
-    LASTCHAR = 0;
     return ascii;
   }
 
-  uint8_t last = LASTCHAR;   // get last char
-  LASTCHAR = ascii;
+  uint8_t last = pos > 0 ? pgm_read_byte(text + pos - 1) : 0;   // get last char
 
   switch (last) {    // conversion depnding on first UTF8-character
     case 0xC2: return  (ascii);  break;
@@ -780,31 +2251,3 @@ uint8_t OLEDDisplay::utf8ascii(byte ascii) {
 
   return  0; // otherwise: return zero, if character has to be ignored
 }
-
-// You need to free the char!
-char* OLEDDisplay::utf8ascii(String str) {
-  uint16_t k = 0;
-  uint16_t length = str.length() + 1;
-
-  // Copy the string into a char array
-  char* s = (char*) malloc(length * sizeof(char));
-  if(!s) {
-    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][utf8ascii] Can't allocate another char array. Drop support for UTF-8.\n");
-    return (char*) str.c_str();
-  }
-  str.toCharArray(s, length);
-
-  length--;
-
-  for (uint16_t i=0; i < length; i++) {
-    char c = utf8ascii(s[i]);
-    if (c!=0) {
-      s[k++]=c;
-    }
-  }
-
-  s[k]=0;
-
-  // This will leak 's' be sure to free it in the calling function.
-  return s;
-}
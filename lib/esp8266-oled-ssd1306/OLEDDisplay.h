@@ -30,6 +30,10 @@
 
 #include <Arduino.h>
 #include "OLEDDisplayFonts.h"
+#include "OLEDDisplayTextCache.h"
+#include "OLEDDisplayList.h"
+#include "OLEDDisplayFontCache.h"
+#include "OLEDDisplayTextLayout.h"
 
 //#define DEBUG_OLEDDISPLAY(...) Serial.printf( __VA_ARGS__ )
 
@@ -37,16 +41,79 @@
 #define DEBUG_OLEDDISPLAY(...)
 #endif
 
-// Use DOUBLE BUFFERING by default
+// OLEDDISPLAY_BANDED draws and sends the screen in bands of
+// OLEDDISPLAY_BAND_PAGES pages, only one band is kept in RAM
+#ifdef OLEDDISPLAY_BANDED
 #ifndef OLEDDISPLAY_REDUCE_MEMORY
+#define OLEDDISPLAY_REDUCE_MEMORY
+#endif
+#ifndef OLEDDISPLAY_BAND_PAGES
+#define OLEDDISPLAY_BAND_PAGES 1
+#endif
+#endif
+
+// Use DOUBLE BUFFERING by default. OLEDDISPLAY_HASH_DIFF finds the changes
+// through a hash per page segment instead of a second buffer.
+#if !defined(OLEDDISPLAY_REDUCE_MEMORY) && !defined(OLEDDISPLAY_HASH_DIFF)
 #define OLEDDISPLAY_DOUBLE_BUFFER
 #endif
 
+// Either way display() only sends what changed
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER) || defined(OLEDDISPLAY_HASH_DIFF)
+#define OLEDDISPLAY_DIFF
+#endif
+
+#ifdef OLEDDISPLAY_HASH_DIFF
+// Columns of a page covered by one hash
+#define HASH_SEGMENT_WIDTH 16
+// A hash collision hides a change until the next full refresh (seconds)
+#ifndef OLEDDISPLAY_HASH_REFRESH
+#define OLEDDISPLAY_HASH_REFRESH 60
+#endif
+#endif
+
+// Clips pushClip() can nest
+#ifndef OLEDDISPLAY_CLIP_DEPTH
+#define OLEDDISPLAY_CLIP_DEPTH 4
+#endif
+
+
+// Panel geometry of the build, set OLEDDISPLAY_GEOMETRY to one of these.
+// All sizes below are constants, so every loop bound and page stride
+// is resolved by the compiler.
+#define GEOMETRY_128_64 0
+#define GEOMETRY_128_32 1
+#define GEOMETRY_64_48  2
+#define GEOMETRY_132_64 3
+
+#ifndef OLEDDISPLAY_GEOMETRY
+#define OLEDDISPLAY_GEOMETRY GEOMETRY_128_64
+#endif
 
 // Display settings
+#if OLEDDISPLAY_GEOMETRY == GEOMETRY_128_32
 #define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 32
+#define DISPLAY_COM_PINS 0x02
+#elif OLEDDISPLAY_GEOMETRY == GEOMETRY_64_48
+#define DISPLAY_WIDTH 64
+#define DISPLAY_HEIGHT 48
+#define DISPLAY_COM_PINS 0x12
+#elif OLEDDISPLAY_GEOMETRY == GEOMETRY_132_64
+#define DISPLAY_WIDTH 132
 #define DISPLAY_HEIGHT 64
-#define DISPLAY_BUFFER_SIZE 1024
+#define DISPLAY_COM_PINS 0x12
+#else
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 64
+#define DISPLAY_COM_PINS 0x12
+#endif
+#define DISPLAY_BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT / 8)
+
+// Controller column of the first panel column. The SH1106 has 132 columns
+// and the SSD1306 128, narrower panels sit in the middle of them.
+#define SH1106_COLUMN_OFFSET  ((132 - DISPLAY_WIDTH) / 2)
+#define SSD1306_COLUMN_OFFSET ((128 - DISPLAY_WIDTH) / 2)
 
 // Header Values
 #define JUMPTABLE_BYTES 4
@@ -61,6 +128,11 @@
 #define FIRST_CHAR_POS 2
 #define CHAR_NUM_POS 3
 
+// Bit 7 of the height marks a font whose glyphs are PackBits streams of
+// the glyph stored page by page, see tools/fontpack.cpp
+#define HEIGHT_MASK  0x7F
+#define FONT_PACKED  0x80
+
 
 // Display commands
 #define CHARGEPUMP 0x8D
@@ -107,10 +179,19 @@ enum OLEDDISPLAY_TEXT_ALIGNMENT {
   TEXT_ALIGN_CENTER_BOTH = 3
 };
 
+struct OLEDDisplayRect {
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+};
+
+struct SpriteBlit;
 
 class OLEDDisplay : public Print {
   public:
-    // Initialize the display
+    // Initialize the display. Calling it again keeps the buffers and
+    // only initializes the display again.
     bool init();
 
     // Free the memory used by the display
@@ -160,22 +241,98 @@ class OLEDDisplay : public Print {
     // Draw a XBM
     void drawXbm(int16_t x, int16_t y, int16_t width, int16_t height, const char *xbm);
 
+    // Draw a sprite stored like the frame buffer, (height + 7) / 8 pages of
+    // `width` bytes, see tools/xbm2sprite.cpp. Without a mask the set pixels
+    // are drawn in the current color. With a mask (same layout) the masked
+    // pixels are replaced by the sprite in WHITE, by the inverted sprite in
+    // BLACK, and INVERSE flips the masked pixels the sprite sets.
+    void drawSprite(int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *sprite, const uint8_t *mask = NULL);
+
+    // Draw a sprite without mask that was compressed with PackBits
+    // (xbm2sprite -p). It is decoded while it is drawn, the rows of the
+    // last page below `height` have to be 0 like xbm2sprite writes them.
+    void drawPackedSprite(int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *sprite);
+
+    // Draw a whole page buffer (in the layout of `buffer`) moved by x/y
+    void drawPageBuffer(int16_t x, int16_t y, const uint8_t *pages);
+
+    // Replace `rows` rows starting at `firstRow` with the same rows of a
+    // page buffer, regardless of the color
+    void copyPageRows(const uint8_t *pages, int16_t firstRow, int16_t rows);
+
+    // Redirect the drawing functions into `target`, a page buffer of
+    // DISPLAY_BUFFER_SIZE bytes that is cleared first, until endOffscreen()
+    void beginOffscreen(uint8_t *target);
+    void endOffscreen(void);
+
+    // Record the drawing functions and the color, font and alignment
+    // setters into `list` instead of drawing until endRecording(). The clip
+    // is the whole screen meanwhile. endRecording() returns false if
+    // something didn't fit or can't be recorded (page buffers, the log).
+    void beginRecording(OLEDDisplayList *list);
+    bool endRecording(void);
+
+    // Draw a recorded list moved by x/y
+    void replay(OLEDDisplayList *list, int16_t x = 0, int16_t y = 0);
+
     /* Text functions */
 
     // Draws a string at the given location
-    void drawString(int16_t x, int16_t y, String text);
+    void drawString(int16_t x, int16_t y, const String &text);
+
+    // Draws `length` bytes of UTF-8 text at the given location. These
+    // overloads never allocate memory. The text may be stored in RAM or
+    // in PROGMEM (as an F() string).
+    void drawString(int16_t x, int16_t y, const char* text, uint16_t length);
+    void drawString(int16_t x, int16_t y, const char* text);
+    void drawString(int16_t x, int16_t y, const __FlashStringHelper* text);
 
     // Draws a String with a maximum width at the given location.
     // If the given String is wider than the specified width
     // The text will be wrapped to the next line at a space or dash
-    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, String text);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const String &text);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char* text, uint16_t length);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char* text);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const __FlashStringHelper* text);
 
-    // Returns the width of the const char* with the current
+    // Returns the width of the UTF-8 const char* with the current
     // font settings
     uint16_t getStringWidth(const char* text, uint16_t length);
+    uint16_t getStringWidth(const char* text);
+    uint16_t getStringWidth(const __FlashStringHelper* text);
 
     // Convencience method for the const char version
-    uint16_t getStringWidth(String text);
+    uint16_t getStringWidth(const String &text);
+
+    // Measure `text` with the current font into `layout`. Lines break at
+    // newlines like drawString() and, with a `maxLineWidth`, wrap at a
+    // space or dash like drawStringMaxWidth(). Lay out a text again only
+    // when it changes.
+    void layoutText(OLEDDisplayTextLayout *layout, const char *text, uint16_t maxLineWidth = 0);
+    void layoutText(OLEDDisplayTextLayout *layout, const char *text, uint16_t length, uint16_t maxLineWidth);
+
+    // Draws a layout with its font and the current alignment, nothing
+    // is measured again
+    void drawTextLayout(int16_t x, int16_t y, OLEDDisplayTextLayout *layout);
+
+    // The rectangle drawTextLayout() draws into at x/y
+    OLEDDisplayRect getTextLayoutBounds(int16_t x, int16_t y, OLEDDisplayTextLayout *layout);
+
+    // Keep up to `size` bytes of rendered strings in a cache. A string that
+    // is drawn again with the same font is then a single blit. 0 disables it.
+    bool setTextCache(uint16_t size);
+
+    // Number of strings drawn from the cache / rendered into the cache
+    uint32_t getTextCacheHits();
+    uint32_t getTextCacheMisses();
+
+    // Reserve up to `size` bytes of RAM for promoted fonts, 0 demotes all
+    bool setFontBudget(uint16_t size);
+
+    // Copy the header and jump table of a font that is drawn every tick
+    // into the font budget, so measuring a string is a sum over a RAM table.
+    // Returns false if the font doesn't fit, it is read from PROGMEM then.
+    bool promoteFont(const char *fontData);
 
     // Specifies relative to which anchor point
     // the text is rendered. Available constants:
@@ -203,15 +360,76 @@ class OLEDDisplay : public Print {
     // Set display contrast
     void setContrast(char contrast);
 
+    // Move the contrast to `contrast` within `time` ms. The steps are sent
+    // by stepFade(), a call with the same target keeps the running fade.
+    void fadeContrast(uint8_t contrast, uint16_t time);
+
+    // Sends the next step of a contrast fade, returns true while it runs
+    bool stepFade(void);
+    bool isFading(void);
+
     // Turn the display upside down
     void flipScreenVertically();
 
+    // Show display RAM row `line` in the top row, the rows above it wrap
+    // around to the bottom. Waits for the pages of a displayAsync() still
+    // in flight.
+    void setStartLine(uint8_t line);
+
     // Write the buffer to the display memory
     virtual void display(void);
 
+    // Takes a snapshot of the changed pages and returns right away, the
+    // pages are then sent by flush(). Drivers that can't send a frame in
+    // steps send all of it here.
+    virtual void displayAsync(void);
+
+    // Sends the next pages of the snapshot taken by displayAsync().
+    // Returns true while pages are left.
+    bool flush(void);
+
+    // True while pages of a displayAsync() wait to be sent
+    bool isFlushing(void);
+
+    // Pages flush() sends per call. With a `budget` (in µs) it instead
+    // keeps sending pages until the budget is used up.
+    void setFlushStep(uint8_t pages, uint16_t budget = 0);
+
     // Clear the local pixel buffer
     void clear(void);
 
+    // Draws a whole screen in passes:
+    //   display.firstBand();
+    //   do { ...draw... } while (display.nextBand());
+    // With OLEDDISPLAY_BANDED each pass draws into one band of pages, which
+    // nextBand() sends before it moves on. Otherwise there is a single pass
+    // that starts with clear() and ends with display().
+    void firstBand(void);
+    bool nextBand(void);
+
+    // True if the rectangle overlaps the pixels the drawing functions
+    // can write right now, e.g. the current band
+    bool isVisible(int16_t x, int16_t y, int16_t width, int16_t height);
+
+    // Restricts the drawing functions to the part of the rectangle inside
+    // of the current clip until popClip(). Returns false and changes
+    // nothing if OLEDDISPLAY_CLIP_DEPTH clips are pushed already, don't
+    // call popClip() then.
+    bool pushClip(int16_t x, int16_t y, int16_t width, int16_t height);
+    void popClip(void);
+
+    // Bytes the last display() sent to the display, including
+    // addressing and control bytes (I2C drivers only)
+    uint16_t getFrameBytes(void);
+
+    // Commands that were not sent because the display already
+    // was in the requested state
+    uint32_t getSuppressedCommands(void);
+
+    // Marks the whole buffer as changed. Call it after writing
+    // to `buffer` directly instead of using the drawing functions.
+    void invalidate(void);
+
     // Log buffer implementation
 
     // This will define the lines and characters you can
@@ -226,19 +444,37 @@ class OLEDDisplay : public Print {
     size_t write(uint8_t c);
     size_t write(const char* s);
 
-    uint8_t            *buffer;
+    // With OLEDDISPLAY_BANDED only the pages of the current band are
+    // backed by memory
+    uint8_t            *buffer                 = NULL;
 
     #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-    uint8_t            *buffer_back;
+    uint8_t            *buffer_back            = NULL;
     #endif
 
   protected:
 
+    #ifdef OLEDDISPLAY_STATIC_BUFFER
+    // The buffers are part of the display object instead of the heap
+    #ifdef OLEDDISPLAY_BANDED
+    uint8_t    bandStorage[DISPLAY_WIDTH * OLEDDISPLAY_BAND_PAGES];
+    #else
+    uint8_t    bufferStorage[DISPLAY_BUFFER_SIZE];
+    #endif
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    uint8_t    backStorage[DISPLAY_BUFFER_SIZE];
+    #endif
+    #endif
+
     OLEDDISPLAY_TEXT_ALIGNMENT   textAlignment = TEXT_ALIGN_LEFT;
     OLEDDISPLAY_COLOR            color         = WHITE;
 
     const char          *fontData              = ArialMT_Plain_10;
 
+    // Fonts promoted to RAM and the current font if it is one of them
+    OLEDDisplayFontCache   fontCache;
+    const OLEDDisplayFont *hotFont               = NULL;
+
     // State values for logBuffer
     uint16_t   logBufferSize                   = 0;
     uint16_t   logBufferFilled                 = 0;
@@ -246,22 +482,216 @@ class OLEDDisplay : public Print {
     uint16_t   logBufferMaxLines               = 0;
     char      *logBuffer                       = NULL;
 
+    // Rendered strings
+    OLEDDisplayTextCache textCache;
+
+    // Columns of each page written since the last display(). A page
+    // is clean when its min column is greater than its max column.
+    uint8_t    dirtyMinX[DISPLAY_HEIGHT / 8];
+    uint8_t    dirtyMaxX[DISPLAY_HEIGHT / 8];
+
+    // Columns of each page written since the last clear()
+    uint8_t    inkMinX[DISPLAY_HEIGHT / 8];
+    uint8_t    inkMaxX[DISPLAY_HEIGHT / 8];
+
+    // The display buffer while drawing offscreen. Columns drawn offscreen
+    // are marked dirty as well, which only costs a few extra compares.
+    uint8_t   *screenBuffer                    = NULL;
+
+    // Pages `buffer` holds, all of them unless OLEDDISPLAY_BANDED is set
+    uint8_t    bandFirstPage                   = 0;
+    uint8_t    bandLastPage                    = DISPLAY_HEIGHT / 8 - 1;
+
+    // The page `buffer` starts with: the first page of the band while a
+    // band is drawn, 0 otherwise (and offscreen)
+    uint8_t    bufferFirstPage                 = 0;
+
+    // Pixels the drawing functions write to, inclusive
+    int16_t    clipMinX                        = 0;
+    int16_t    clipMaxX                        = DISPLAY_WIDTH - 1;
+    int16_t    clipMinY                        = 0;
+    int16_t    clipMaxY                        = DISPLAY_HEIGHT - 1;
+
+    // Clips replaced by pushClip(), min x, min y, max x and max y
+    int16_t    clipStack[OLEDDISPLAY_CLIP_DEPTH][4];
+    uint8_t    clipDepth                       = 0;
+
+    // The list being recorded and the clip it replaced
+    OLEDDisplayList *recordList                = NULL;
+    int16_t    recordClip[4];
+    uint8_t    recordClipDepth                 = 0;
+
+    #ifdef OLEDDISPLAY_BANDED
+    // Memory of the band, `buffer` points to it while a band is drawn
+    uint8_t   *bandBuffer                      = NULL;
+    #endif
+
+    // Bus traffic of the last display()
+    uint16_t   frameBytes                      = 0;
+
+    // Controller state as last sent, -1 while unknown. Setters that
+    // would send the same state again are dropped.
+    int16_t    panelContrast                   = -1;
+    int8_t     panelOn                         = -1;
+    int8_t     panelInverted                   = -1;
+    int8_t     panelFlipped                    = -1;
+    int8_t     panelStartLine                  = -1;
+    uint32_t   suppressedCommands              = 0;
+
+    // Contrast fade of fadeContrast()
+    bool       fading                          = false;
+    uint8_t    fadeFrom                        = 0;
+    uint8_t    fadeTo                          = 0;
+    uint16_t   fadeTime                        = 0;
+    uint32_t   fadeStart                       = 0;
+
+    // Size of a flush() step
+    uint8_t    flushPages                      = 1;
+    uint16_t   flushBudget                     = 0;
+
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    // Changed columns of each page that were not sent yet. buffer_back
+    // already holds them, so drawing the next frame can't tear them.
+    uint8_t    pendingColumns[DISPLAY_HEIGHT / 8][(DISPLAY_WIDTH + 7) / 8];
+    uint8_t    pendingPages                    = 0;
+
+    // Start line to send after the pending pages, -1 for none
+    int8_t     pendingStartLine                = -1;
+    #endif
+
+    #ifdef OLEDDISPLAY_HASH_DIFF
+    // Hash of each segment as last sent. Pages in refreshPages are sent
+    // whole, whatever their hashes say.
+    uint32_t   segmentHash[DISPLAY_HEIGHT / 8][(DISPLAY_WIDTH + HASH_SEGMENT_WIDTH - 1) / HASH_SEGMENT_WIDTH];
+    uint8_t    refreshPages                    = 0xFF;
+    uint32_t   lastRefresh                     = 0;
+    #endif
+
+    #ifdef OLEDDISPLAY_DIFF
+    // Unchanged columns between two changed runs of a page that are
+    // cheaper to resend than a new address setup (set by the driver)
+    uint8_t    spanMergeGap                    = 0;
+    #endif
+
     // Send a command to the display (low level function)
     virtual void sendCommand(uint8_t com) {};
 
+    // Send the commands a driver may have queued in sendCommand()
+    virtual void flushCommands() {};
+
+    // Send `length` bytes of `page` starting at `column` (drivers that
+    // support sending a frame in steps)
+    virtual void sendData(uint8_t page, uint8_t column, const uint8_t *data, uint8_t length) {};
+
     // Connect to the display
     virtual bool connect() {};
 
+    // Points the buffers to their memory unless they already have it
+    bool allocateBuffers();
+
     // Send all the init commands
     void sendInitCommands();
 
-    // converts utf8 characters to extended ascii
-    static char* utf8ascii(String s);
-    static byte utf8ascii(byte ascii);
+    // Sends the contrast unless the display already has it
+    void sendContrast(uint8_t contrast);
+
+    // Clips the drawing functions to the pages of the band and
+    // drops the pushed clips
+    void resetClip();
+
+    #ifdef OLEDDISPLAY_BANDED
+    // Selects and clears the band starting at `page`
+    void beginBand(uint8_t page);
+
+    // Sends the pages of the band, only the changed runs
+    // with OLEDDISPLAY_HASH_DIFF
+    void sendBand();
+    #endif
 
-    void inline drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *data, uint16_t offset, uint16_t bytesInData) __attribute__((always_inline));
+    // The byte of column `x` of `page` in `buffer`, the page must be one
+    // that `buffer` holds
+    uint8_t* pagePtr(uint8_t page, int16_t x = 0) {
+      return buffer + ((page - bufferFirstPage) * DISPLAY_WIDTH + x);
+    }
+
+    // Records that the given columns of the given pages were written
+    void inline markDirty(int16_t firstColumn, int16_t lastColumn, int8_t firstPage, int8_t lastPage) __attribute__((always_inline));
+
+    #ifdef OLEDDISPLAY_DIFF
+    // Copies the dirty columns of `buffer` to `buffer_back` and returns the
+    // bounding box of the bytes that changed, or false if nothing did
+    bool collectChanges(uint8_t &minBoundX, uint8_t &maxBoundX, uint8_t &minBoundY, uint8_t &maxBoundY);
+
+    // Finds the next run of changed columns [x, lastX] of `page` starting at
+    // `x` and copies it to `buffer_back`. Runs separated by at most `mergeGap`
+    // unchanged columns are joined. Returns false when the page is done.
+    // (With OLEDDISPLAY_HASH_DIFF the run covers whole changed segments
+    // within the dirty columns and updates their hashes instead.)
+    bool nextChangedSpan(uint8_t page, uint8_t &x, uint8_t &lastX, uint8_t mergeGap);
+    #endif
+
+    #ifdef OLEDDISPLAY_HASH_DIFF
+    // Sends the changed runs of all pages through sendData()
+    void sendChangedSpans();
+
+    // Hashes a segment and returns true if it changed since it was sent
+    bool updateSegmentHash(uint8_t page, uint8_t segment);
+
+    // Starts the periodic full refresh when it is due
+    void checkRefresh();
+    #endif
+
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+
+    // Copies the changed columns to buffer_back and marks them pending
+    void takeSnapshot();
+
+    // Sends up to `pages` pending pages through sendData(), or as many as
+    // fit into `budget` µs. Returns true while pages are left.
+    bool sendPendingPages(uint8_t pages, uint16_t budget);
+    #endif
 
-    void drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth);
+    // Converts the utf8 character ending at text[pos] to extended ascii,
+    // returns 0 for bytes that don't complete a character
+    static uint8_t utf8ascii(const char* text, uint16_t pos);
+
+    // Header values and glyph widths of the current font, read from RAM
+    // if the font was promoted
+    uint8_t fontHeight() {
+      return hotFont ? hotFont->height : pgm_read_byte(fontData + HEIGHT_POS) & HEIGHT_MASK;
+    }
+    bool fontPacked() {
+      return hotFont ? hotFont->packed : pgm_read_byte(fontData + HEIGHT_POS) & FONT_PACKED;
+    }
+    uint8_t fontFirstChar() {
+      return hotFont ? hotFont->firstChar : pgm_read_byte(fontData + FIRST_CHAR_POS);
+    }
+    uint16_t fontDataStart() {
+      return hotFont ? 0 : JUMPTABLE_START + pgm_read_byte(fontData + CHAR_NUM_POS) * JUMPTABLE_BYTES;
+    }
+    uint8_t charWidth(uint8_t charCode) {
+      if (hotFont) return charCode < hotFont->charCount ? hotFont->widths[charCode] : 0;
+      // Fonts cut down by tools/fontconv.cpp may end before 255
+      if (charCode >= pgm_read_byte(fontData + CHAR_NUM_POS)) return 0;
+      return pgm_read_byte(fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+    }
+
+    // Position of the glyph data in fontData and its size, false if the
+    // glyph isn't drawable. `dataStart` is fontDataStart().
+    bool getGlyph(uint8_t charCode, uint16_t dataStart, uint16_t *position, uint8_t *size);
+
+    void inline drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *data, uint16_t offset, uint16_t bytesInData, bool packed = false) __attribute__((always_inline));
+
+    // Appends a command with `count` arguments to the recorded list
+    void recordCommand(uint8_t op, const int16_t *args, uint8_t count);
+
+    // Clips a sprite or XBM and marks it dirty, false if it isn't visible
+    bool clipSprite(SpriteBlit &blit, int16_t xMove, int16_t yMove, int16_t width, int16_t height);
+
+    void drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, uint16_t textWidth);
+
+    // Renders a string into a new text cache entry
+    uint8_t* renderTextRun(const char* text, uint16_t textLength, uint16_t *runWidth);
 
 };
 
@@ -0,0 +1,90 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include "OLEDDisplayFontCache.h"
+#include "OLEDDisplay.h"
+
+bool OLEDDisplayFontCache::setSize(uint16_t size) {
+  if (this->arena != NULL) free(this->arena);
+  this->arena     = NULL;
+  this->arenaSize = 0;
+  this->clear();
+  if (size > 0) {
+    this->arena = (uint8_t *) malloc(size);
+    if (!this->arena) {
+      return false;
+    }
+    this->arenaSize = size;
+  }
+  return true;
+}
+
+void OLEDDisplayFontCache::clear() {
+  this->used      = 0;
+  this->fontCount = 0;
+}
+
+const OLEDDisplayFont* OLEDDisplayFontCache::find(const char *fontData) {
+  for (uint8_t i = 0; i < this->fontCount; i++) {
+    if (this->fonts[i].fontData == fontData) return &this->fonts[i];
+  }
+  return NULL;
+}
+
+const OLEDDisplayFont* OLEDDisplayFontCache::promote(const char *fontData) {
+  const OLEDDisplayFont *promoted = this->find(fontData);
+  if (promoted != NULL) return promoted;
+
+  uint8_t charCount = pgm_read_byte(fontData + CHAR_NUM_POS);
+  // The offsets go first, `used` stays even so they are aligned
+  uint16_t size = (charCount * 4 + 1) & ~1;
+  if (this->fontCount == OLEDDISPLAY_HOT_FONTS || this->used + size > this->arenaSize) {
+    return NULL;
+  }
+
+  OLEDDisplayFont *font = &this->fonts[this->fontCount++];
+  font->fontData  = fontData;
+  font->offsets   = (uint16_t *) (this->arena + this->used);
+  font->widths    = (uint8_t *) (font->offsets + charCount);
+  font->sizes     = font->widths + charCount;
+  font->height    = pgm_read_byte(fontData + HEIGHT_POS) & HEIGHT_MASK;
+  font->packed    = pgm_read_byte(fontData + HEIGHT_POS) & FONT_PACKED;
+  font->firstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+  font->charCount = charCount;
+  this->used += size;
+
+  uint16_t dataStart = JUMPTABLE_START + charCount * JUMPTABLE_BYTES;
+  for (uint16_t i = 0; i < charCount; i++) {
+    const char *jump = fontData + JUMPTABLE_START + i * JUMPTABLE_BYTES;
+    byte msbJumpToChar = pgm_read_byte(jump);
+    byte lsbJumpToChar = pgm_read_byte(jump + JUMPTABLE_LSB);
+    font->offsets[i] = msbJumpToChar == 255 && lsbJumpToChar == 255 ? OLEDDISPLAY_NO_GLYPH : dataStart + ((msbJumpToChar << 8) + lsbJumpToChar);
+    font->sizes[i]   = pgm_read_byte(jump + JUMPTABLE_SIZE);
+    font->widths[i]  = pgm_read_byte(jump + JUMPTABLE_WIDTH);
+  }
+  return font;
+}
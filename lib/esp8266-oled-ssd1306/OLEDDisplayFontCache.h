@@ -0,0 +1,84 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#ifndef OLEDDISPLAYFONTCACHE_h
+#define OLEDDISPLAYFONTCACHE_h
+
+#include <Arduino.h>
+
+// Fonts that can be promoted at the same time
+#ifndef OLEDDISPLAY_HOT_FONTS
+#define OLEDDISPLAY_HOT_FONTS 4
+#endif
+
+// Offset of a glyph without data
+#define OLEDDISPLAY_NO_GLYPH 0xFFFF
+
+// The decoded header and jump table of a font promoted to RAM. The glyph
+// data itself stays in PROGMEM, `offsets` point into `fontData`.
+struct OLEDDisplayFont {
+  const char *fontData;
+  uint16_t   *offsets;
+  uint8_t    *widths;
+  uint8_t    *sizes;
+  uint8_t     height;
+  uint8_t     firstChar;
+  uint8_t     charCount;
+  bool        packed;
+};
+
+// Fonts drawn every tick, promoted into one arena that is allocated once.
+// Fonts that were not promoted are read from PROGMEM as before.
+class OLEDDisplayFontCache {
+  public:
+    // Allocate an arena of `size` bytes, 0 frees the arena again
+    bool setSize(uint16_t size);
+
+    bool isEnabled() { return this->arena != NULL; }
+
+    // Decodes `fontData` into the arena, 4 bytes per glyph. Returns NULL
+    // if it doesn't fit into what is left of the arena.
+    const OLEDDisplayFont* promote(const char *fontData);
+
+    // The promoted `fontData` or NULL
+    const OLEDDisplayFont* find(const char *fontData);
+
+    // Demote all fonts but keep the arena
+    void clear();
+
+    uint16_t getUsed() { return this->used; }
+
+  private:
+    uint8_t          *arena     = NULL;
+    uint16_t          arenaSize = 0;
+    uint16_t          used      = 0;
+
+    OLEDDisplayFont   fonts[OLEDDISPLAY_HOT_FONTS];
+    uint8_t           fontCount = 0;
+};
+
+#endif
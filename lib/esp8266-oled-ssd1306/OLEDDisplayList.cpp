@@ -0,0 +1,119 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include "OLEDDisplayList.h"
+
+bool OLEDDisplayList::setSize(uint16_t size) {
+  if (this->arena != NULL) free(this->arena);
+  this->arena     = NULL;
+  this->arenaSize = 0;
+  clear();
+  if (size > 0) {
+    this->arena = (uint8_t *) malloc(size);
+    if (!this->arena) {
+      return false;
+    }
+    this->arenaSize = size;
+  }
+  return true;
+}
+
+void OLEDDisplayList::clear() {
+  this->used  = 0;
+  this->hash  = 2166136261UL;
+  this->valid = true;
+}
+
+// FNV-1a over everything that is appended
+void OLEDDisplayList::append(const void *data, uint16_t length) {
+  if (!this->valid || this->arena == NULL || this->arenaSize - this->used < length) {
+    this->valid = false;
+    return;
+  }
+  const uint8_t *bytes = (const uint8_t *) data;
+  uint8_t *target = this->arena + this->used;
+  for (uint16_t i = 0; i < length; i++) {
+    target[i] = bytes[i];
+    this->hash = (this->hash ^ bytes[i]) * 16777619UL;
+  }
+  this->used += length;
+}
+
+void OLEDDisplayList::put8(uint8_t value) {
+  append(&value, 1);
+}
+
+void OLEDDisplayList::put16(int16_t value) {
+  append(&value, 2);
+}
+
+void OLEDDisplayList::putRef(const void *ref) {
+  if (ref != NULL && (uintptr_t) ref < OLEDDISPLAY_FLASH_START) {
+    this->valid = false;
+    return;
+  }
+  append(&ref, sizeof(ref));
+}
+
+void OLEDDisplayList::putText(const char *text, uint16_t length) {
+  put16(length);
+  if (!this->valid || this->arenaSize - this->used < length) {
+    this->valid = false;
+    return;
+  }
+  uint8_t *target = this->arena + this->used;
+  for (uint16_t i = 0; i < length; i++) {
+    target[i] = pgm_read_byte(text + i);
+    this->hash = (this->hash ^ target[i]) * 16777619UL;
+  }
+  this->used += length;
+}
+
+uint8_t OLEDDisplayList::get8(uint16_t &pos) {
+  return this->arena[pos++];
+}
+
+int16_t OLEDDisplayList::get16(uint16_t &pos) {
+  int16_t value;
+  memcpy(&value, this->arena + pos, 2);
+  pos += 2;
+  return value;
+}
+
+const void* OLEDDisplayList::getRef(uint16_t &pos) {
+  const void *ref;
+  memcpy(&ref, this->arena + pos, sizeof(ref));
+  pos += sizeof(ref);
+  return ref;
+}
+
+const char* OLEDDisplayList::getText(uint16_t &pos, uint16_t *length) {
+  *length = get16(pos);
+  const char *text = (const char *) this->arena + pos;
+  pos += *length;
+  return text;
+}
@@ -0,0 +1,108 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#ifndef OLEDDISPLAYLIST_h
+#define OLEDDISPLAYLIST_h
+
+#include <Arduino.h>
+
+// Data from this address on is mapped flash (PROGMEM) and can't change
+#ifndef OLEDDISPLAY_FLASH_START
+#define OLEDDISPLAY_FLASH_START 0x40200000UL
+#endif
+
+// Commands of a display list, each one is followed by its arguments
+enum OLEDDisplayListOp {
+  LIST_COLOR,           // color
+  LIST_ALIGNMENT,       // alignment
+  LIST_FONT,            // font
+  LIST_PIXEL,           // x, y
+  LIST_LINE,            // x0, y0, x1, y1
+  LIST_RECT,            // x, y, width, height
+  LIST_FILL_RECT,       // x, y, width, height
+  LIST_CIRCLE,          // x, y, radius
+  LIST_CIRCLE_QUADS,    // x, y, radius, quads
+  LIST_FILL_CIRCLE,     // x, y, radius
+  LIST_PROGRESS_BAR,    // x, y, width, height, progress
+  LIST_FAST_IMAGE,      // x, y, width, height, image
+  LIST_XBM,             // x, y, width, height, xbm
+  LIST_SPRITE,          // x, y, width, height, sprite, mask
+  LIST_PACKED_SPRITE,   // x, y, width, height, sprite
+  LIST_STRING,          // x, y, text
+  LIST_STRING_MAX_WIDTH,// x, y, max width, text
+  LIST_STRING_LINE,     // x, y, width, text
+  LIST_PUSH_CLIP,       // x, y, width, height
+  LIST_POP_CLIP
+};
+
+// Draw commands recorded by OLEDDisplay::beginRecording(), packed into one
+// arena that is allocated once. Strings are copied into the list, fonts and
+// images are kept as references to flash, a reference to RAM (which may
+// change behind it) invalidates the list. The hash covers every recorded
+// byte, two recordings with the same hash and length draw the same pixels
+// unless the hash collides.
+class OLEDDisplayList {
+  public:
+    // Allocate an arena of `size` bytes, 0 frees the arena again
+    bool setSize(uint16_t size);
+
+    bool isEnabled() { return this->arena != NULL; }
+
+    // Drop all commands but keep the arena
+    void clear();
+
+    // False once a command didn't fit or couldn't be recorded, the
+    // list must not be replayed then
+    bool isValid() { return this->valid && this->arena != NULL; }
+    void invalidate() { this->valid = false; }
+
+    uint32_t getHash()   { return this->hash; }
+    uint16_t getLength() { return this->used; }
+
+    // Appending, `text` may point to RAM or PROGMEM
+    void put8(uint8_t value);
+    void put16(int16_t value);
+    void putRef(const void *ref);
+    void putText(const char *text, uint16_t length);
+
+    // Reading at `pos`, which is moved behind the value
+    uint8_t     get8(uint16_t &pos);
+    int16_t     get16(uint16_t &pos);
+    const void* getRef(uint16_t &pos);
+    const char* getText(uint16_t &pos, uint16_t *length);
+
+  private:
+    uint8_t   *arena     = NULL;
+    uint16_t   arenaSize = 0;
+    uint16_t   used      = 0;
+    uint32_t   hash      = 2166136261UL;
+    bool       valid     = true;
+
+    void append(const void *data, uint16_t length);
+};
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#include "OLEDDisplayTextCache.h"
+
+// Entries are kept aligned so the header can be read directly
+#define TEXTCACHE_ALIGNMENT   alignof(OLEDDisplayTextCacheEntry)
+#define TEXTCACHE_ALIGN(size) (((size) + TEXTCACHE_ALIGNMENT - 1) & ~(TEXTCACHE_ALIGNMENT - 1))
+
+bool OLEDDisplayTextCache::setSize(uint16_t size) {
+  if (this->arena != NULL) free(this->arena);
+  this->arena     = NULL;
+  this->arenaSize = 0;
+  this->used      = 0;
+  if (size > 0) {
+    this->arena = (uint8_t *) malloc(size);
+    if (!this->arena) {
+      return false;
+    }
+    this->arenaSize = size;
+  }
+  return true;
+}
+
+void OLEDDisplayTextCache::clear() {
+  this->used = 0;
+}
+
+uint16_t OLEDDisplayTextCache::hashText(const char *fontData, const char *text, uint16_t textLength) {
+  uint16_t hash = (uint16_t) ((uintptr_t) fontData ^ ((uintptr_t) fontData >> 16));
+  for (uint16_t i = 0; i < textLength; i++) {
+    hash = (hash << 5) + hash + pgm_read_byte(text + i);
+  }
+  return hash;
+}
+
+const uint8_t* OLEDDisplayTextCache::lookup(const char *fontData, const char *text, uint16_t textLength, uint16_t *width) {
+  uint16_t hash = hashText(fontData, text, textLength);
+  uint16_t pos = 0;
+  while (pos < this->used) {
+    OLEDDisplayTextCacheEntry *entry = (OLEDDisplayTextCacheEntry *) (this->arena + pos);
+    const char *entryText = (const char *) (entry + 1);
+    if (entry->hash == hash && entry->fontData == fontData && entry->textLength == textLength &&
+        memcmp_P(entryText, text, textLength) == 0) {
+      entry->lastUse = ++this->useClock;
+      *width = entry->width;
+      this->hits++;
+      return (const uint8_t *) entryText + TEXTCACHE_ALIGN(textLength);
+    }
+    pos += entry->size;
+  }
+  this->misses++;
+  return NULL;
+}
+
+uint8_t* OLEDDisplayTextCache::insert(const char *fontData, const char *text, uint16_t textLength, uint16_t width, uint8_t rasterHeight) {
+  if (this->arena == NULL || textLength > 255) return NULL;
+
+  uint32_t bitmapSize = (uint32_t) width * rasterHeight;
+  uint32_t size = sizeof(OLEDDisplayTextCacheEntry) + TEXTCACHE_ALIGN(textLength) + TEXTCACHE_ALIGN(bitmapSize);
+  if (bitmapSize == 0 || size > this->arenaSize) return NULL;
+
+  while ((uint32_t) (this->arenaSize - this->used) < size) {
+    evictLeastRecentlyUsed();
+  }
+
+  OLEDDisplayTextCacheEntry *entry = (OLEDDisplayTextCacheEntry *) (this->arena + this->used);
+  entry->fontData     = fontData;
+  entry->lastUse      = ++this->useClock;
+  entry->size         = size;
+  entry->width        = width;
+  entry->textLength   = textLength;
+  entry->rasterHeight = rasterHeight;
+  entry->hash         = hashText(fontData, text, textLength);
+
+  uint8_t *entryText = (uint8_t *) (entry + 1);
+  memcpy_P(entryText, text, textLength);
+
+  uint8_t *bitmap = entryText + TEXTCACHE_ALIGN(textLength);
+  memset(bitmap, 0, bitmapSize);
+
+  this->used += size;
+  return bitmap;
+}
+
+void OLEDDisplayTextCache::evictLeastRecentlyUsed() {
+  uint16_t oldestPos = 0;
+  uint32_t oldestUse = ~0;
+  uint16_t pos = 0;
+  while (pos < this->used) {
+    OLEDDisplayTextCacheEntry *entry = (OLEDDisplayTextCacheEntry *) (this->arena + pos);
+    if (entry->lastUse <= oldestUse) {
+      oldestUse = entry->lastUse;
+      oldestPos = pos;
+    }
+    pos += entry->size;
+  }
+
+  uint16_t size = ((OLEDDisplayTextCacheEntry *) (this->arena + oldestPos))->size;
+  memmove(this->arena + oldestPos, this->arena + oldestPos + size, this->used - oldestPos - size);
+  this->used -= size;
+}
@@ -0,0 +1,82 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#ifndef OLEDDISPLAYTEXTCACHE_h
+#define OLEDDISPLAYTEXTCACHE_h
+
+#include <Arduino.h>
+
+// Header of a cached text run. It is followed by the text itself and
+// the rendered bitmap in the format used by `drawFastImage`.
+struct OLEDDisplayTextCacheEntry {
+  const char *fontData;
+  uint32_t    lastUse;
+  uint16_t    size;
+  uint16_t    width;
+  uint8_t     textLength;
+  uint8_t     rasterHeight;
+  uint16_t    hash;
+};
+
+// A least recently used cache of rendered strings. All entries live
+// packed in one arena that is allocated once, evicting an entry moves
+// the entries behind it to the front.
+class OLEDDisplayTextCache {
+  public:
+    // Allocate an arena of `size` bytes, 0 frees the arena again
+    bool setSize(uint16_t size);
+
+    bool isEnabled() { return this->arena != NULL; }
+
+    // Returns the bitmap of `text` rendered with `fontData` or NULL.
+    // `text` may point to RAM or PROGMEM.
+    const uint8_t* lookup(const char *fontData, const char *text, uint16_t textLength, uint16_t *width);
+
+    // Reserves a zeroed bitmap for `text`, evicting old entries if needed.
+    // Returns NULL if the bitmap can't fit into the arena at all.
+    uint8_t* insert(const char *fontData, const char *text, uint16_t textLength, uint16_t width, uint8_t rasterHeight);
+
+    // Drop all entries but keep the arena
+    void clear();
+
+    uint32_t getHits()   { return this->hits; }
+    uint32_t getMisses() { return this->misses; }
+
+  private:
+    uint8_t   *arena     = NULL;
+    uint16_t   arenaSize = 0;
+    uint16_t   used      = 0;
+    uint32_t   useClock  = 0;
+
+    uint32_t   hits      = 0;
+    uint32_t   misses    = 0;
+
+    static uint16_t hashText(const char *fontData, const char *text, uint16_t textLength);
+    void evictLeastRecentlyUsed();
+};
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#ifndef OLEDDISPLAYTEXTLAYOUT_h
+#define OLEDDISPLAYTEXTLAYOUT_h
+
+#include <Arduino.h>
+
+// Lines a layout can hold, the lines after them are dropped
+#ifndef OLEDDISPLAY_LAYOUT_LINES
+#define OLEDDISPLAY_LAYOUT_LINES 4
+#endif
+
+struct OLEDDisplayTextLine {
+  uint16_t start;   // first byte of the line in the text
+  uint16_t length;
+  uint16_t width;
+  uint8_t  row;     // lines are drawn row * line height below the first
+};
+
+// A text measured once by OLEDDisplay::layoutText(): its lines, their
+// widths and the bounding box. drawTextLayout() draws it at any position
+// and with any alignment without measuring it again. The text isn't
+// copied, it has to stay unchanged while the layout is in use.
+class OLEDDisplayTextLayout {
+  friend class OLEDDisplay;
+
+  public:
+    // Widest line and the height of all rows
+    uint16_t getWidth()  { return this->width; }
+    uint16_t getHeight() { return this->rows * this->lineHeight; }
+
+    uint8_t getLineCount() { return this->lineCount; }
+    const OLEDDisplayTextLine* getLine(uint8_t line) { return &this->lines[line]; }
+
+    // True if the text had more than OLEDDISPLAY_LAYOUT_LINES lines
+    bool isTruncated() { return this->truncated; }
+
+  private:
+    const char           *text         = NULL;
+    const char           *fontData     = NULL;
+    uint16_t              width        = 0;
+    // Moves the rows up for TEXT_ALIGN_CENTER_BOTH
+    uint16_t              centerOffset = 0;
+    uint8_t               lineHeight   = 0;
+    uint8_t               rows         = 0;
+    uint8_t               lineCount    = 0;
+    bool                  truncated    = false;
+    OLEDDisplayTextLine   lines[OLEDDISPLAY_LAYOUT_LINES];
+
+    bool addLine(uint16_t start, uint16_t length, uint16_t width, uint8_t row) {
+      if (this->lineCount == OLEDDISPLAY_LAYOUT_LINES) {
+        this->truncated = true;
+        return false;
+      }
+      OLEDDisplayTextLine &line = this->lines[this->lineCount++];
+      line.start  = start;
+      line.length = length;
+      line.width  = width;
+      line.row    = row;
+      this->rows  = row + 1;
+      if (width > this->width) this->width = width;
+      return true;
+    }
+};
+
+#endif
@@ -26,22 +26,70 @@
 
 #include "OLEDDisplayUi.h"
 
+// Time between the steps of a contrast fade (µs)
+#define FADE_STEP_INTERVAL 20000
+
+// Eased transition progress at 16 steps of the transition time,
+// values in between are interpolated
+#define EASING_STEPS 16
+
+static const int16_t EASING_EASE_IN_OUT_TABLE[EASING_STEPS + 1] PROGMEM = {
+  0, 2, 10, 22, 37, 57, 79, 103, 128, 153, 177, 199, 219, 234, 246, 254, 256
+};
+
+// Damped oscillation around the end position
+static const int16_t EASING_SPRING_TABLE[EASING_STEPS + 1] PROGMEM = {
+  0, 101, 189, 248, 278, 286, 282, 274, 265, 259, 255, 253, 253, 254, 255, 256, 256
+};
+
 OLEDDisplayUi::OLEDDisplayUi(OLEDDisplay *display) {
   this->display = display;
 }
 
-void OLEDDisplayUi::init() {
-  this->display->init();
+bool OLEDDisplayUi::init() {
+  if (!this->display->init()) {
+    return false;
+  }
+
+  // Without the transition cache the frames are drawn on every tick
+  #if defined(OLEDDISPLAY_STATIC_BUFFER) && !defined(OLEDDISPLAY_REDUCE_MEMORY)
+  this->transitionBuffer = this->transitionStorage;
+  #elif !defined(OLEDDISPLAY_REDUCE_MEMORY)
+  if (!this->transitionBuffer) {
+    this->transitionBuffer = (uint8_t*) malloc(sizeof(uint8_t) * DISPLAY_BUFFER_SIZE * 2);
+    if (!this->transitionBuffer) {
+      DEBUG_OLEDDISPLAYUI("[OLEDDISPLAYUI][init] Not enough memory to cache transitions\n");
+    }
+  }
+  #endif
+  return true;
 }
 
 void OLEDDisplayUi::setTargetFPS(uint8_t fps){
-  float oldInterval = this->updateInterval;
-  this->updateInterval = ((float) 1.0 / (float) fps) * 1000;
+  this->updateInterval = 1000000UL / fps;
+}
+
+void OLEDDisplayUi::setIdleFPS(uint8_t fps){
+  this->idleInterval = fps ? 1000000UL / fps : 0;
+}
 
-  // Calculate new ticksPerFrame
-  float changeRatio = oldInterval / (float) this->updateInterval;
-  this->ticksPerFrame *= changeRatio;
-  this->ticksPerTransition *= changeRatio;
+void OLEDDisplayUi::wake(){
+  this->wakeRequested = true;
+}
+
+void OLEDDisplayUi::enableAsyncFlush(){
+  this->asyncFlush = true;
+}
+void OLEDDisplayUi::disableAsyncFlush(){
+  this->asyncFlush = false;
+  while (this->display->flush());
+}
+
+void OLEDDisplayUi::enableHardwareScroll(){
+  this->hardwareScroll = true;
+}
+void OLEDDisplayUi::disableHardwareScroll(){
+  this->hardwareScroll = false;
 }
 
 // -/------ Automatic controll ------\-
@@ -61,10 +109,10 @@ void OLEDDisplayUi::setAutoTransitionBackwards(){
   this->lastTransitionDirection = -1;
 }
 void OLEDDisplayUi::setTimePerFrame(uint16_t time){
-  this->ticksPerFrame = (int) ( (float) time / (float) updateInterval);
+  this->timePerFrame = (uint32_t) time * 1000;
 }
 void OLEDDisplayUi::setTimePerTransition(uint16_t time){
-  this->ticksPerTransition = (int) ( (float) time / (float) updateInterval);
+  this->timePerTransition = (uint32_t) time * 1000;
 }
 
 // -/------ Customize indicator position and style -------\-
@@ -78,40 +126,75 @@ void OLEDDisplayUi::disableIndicator(){
 
 void OLEDDisplayUi::enableAllIndicators(){
   this->shouldDrawIndicators = true;
+  this->invalidate();
 }
 
 void OLEDDisplayUi::disableAllIndicators(){
   this->shouldDrawIndicators = false;
+  this->invalidate();
 }
 
 void OLEDDisplayUi::setIndicatorPosition(IndicatorPosition pos) {
   this->indicatorPosition = pos;
+  this->invalidate();
 }
 void OLEDDisplayUi::setIndicatorDirection(IndicatorDirection dir) {
   this->indicatorDirection = dir;
+  this->invalidate();
 }
 void OLEDDisplayUi::setActiveSymbol(const char* symbol) {
   this->activeSymbol = symbol;
+  this->invalidate();
 }
 void OLEDDisplayUi::setInactiveSymbol(const char* symbol) {
   this->inactiveSymbol = symbol;
+  this->invalidate();
 }
 
 
 // -/----- Frame settings -----\-
+void OLEDDisplayUi::setTransitionEasing(TransitionEasing easing) {
+  this->transitionEasing = easing;
+}
 void OLEDDisplayUi::setFrameAnimation(AnimationDirection dir) {
   this->frameAnimationDirection = dir;
 }
-void OLEDDisplayUi::setFrames(FrameCallback* frameFunctions, uint8_t frameCount) {
-  this->frameFunctions = frameFunctions;
-  this->frameCount     = frameCount;
+void OLEDDisplayUi::setFrames(FrameCallback* frameFunctions, uint8_t frameCount, VersionCallback* versionFunctions, BoundsCallback* boundsFunctions) {
+  this->frameFunctions        = frameFunctions;
+  this->frameVersionFunctions = versionFunctions;
+  this->frameBoundsFunctions  = boundsFunctions;
+  this->frameCount            = frameCount;
   this->resetState();
 }
 
 // -/----- Overlays ------\-
-void OLEDDisplayUi::setOverlays(OverlayCallback* overlayFunctions, uint8_t overlayCount){
-  this->overlayFunctions = overlayFunctions;
-  this->overlayCount     = overlayCount;
+void OLEDDisplayUi::setOverlays(OverlayCallback* overlayFunctions, uint8_t overlayCount, VersionCallback* versionFunctions, BoundsCallback* boundsFunctions){
+  this->overlayFunctions        = overlayFunctions;
+  this->overlayVersionFunctions = versionFunctions;
+  this->overlayBoundsFunctions  = boundsFunctions;
+  this->overlayCount            = overlayCount;
+  this->invalidate();
+}
+
+bool OLEDDisplayUi::setDisplayListSize(uint16_t size){
+  this->drawnListValid = false;
+  this->cachedFrame = -1;
+  bool allocated = this->screenList.setSize(size);
+  #ifdef OLEDDISPLAY_REDUCE_MEMORY
+  allocated = this->frameLists[0].setSize(size) && allocated;
+  allocated = this->frameLists[1].setSize(size) && allocated;
+  #endif
+  if (!allocated) {
+    DEBUG_OLEDDISPLAYUI("[OLEDDISPLAYUI][setDisplayListSize] Not enough memory for the display lists\n");
+  }
+  return allocated;
+}
+
+void OLEDDisplayUi::invalidate(){
+  this->drawnVersionValid = false;
+  this->drawnListValid = false;
+  this->unrecordedFrame = -1;
+  this->wakeRequested = true;
 }
 
 // -/----- Loading Process -----\-
@@ -121,9 +204,10 @@ void OLEDDisplayUi::runLoadingProcess(LoadingStage* stages, uint8_t stagesCount)
   uint8_t increment = 100 / stagesCount;
 
   for (uint8_t i = 0; i < stagesCount; i++) {
-    display->clear();
-    this->loadingDrawFunction(this->display, &stages[i], progress);
-    display->display();
+    display->firstBand();
+    do {
+      this->loadingDrawFunction(this->display, &stages[i], progress);
+    } while (display->nextBand());
 
     stages[i].callback();
 
@@ -131,9 +215,10 @@ void OLEDDisplayUi::runLoadingProcess(LoadingStage* stages, uint8_t stagesCount)
     yield();
   }
 
-  display->clear();
-  this->loadingDrawFunction(this->display, &stages[stagesCount-1], progress);
-  display->display();
+  display->firstBand();
+  do {
+    this->loadingDrawFunction(this->display, &stages[stagesCount-1], progress);
+  } while (display->nextBand());
 
   delay(150);
 }
@@ -144,6 +229,7 @@ void OLEDDisplayUi::nextFrame() {
     this->state.manuelControll = true;
     this->state.frameState = IN_TRANSITION;
     this->state.ticksSinceLastStateSwitch = 0;
+    this->stateStartPending = true;
     this->lastTransitionDirection = this->state.frameTransitionDirection;
     this->state.frameTransitionDirection = 1;
   }
@@ -153,6 +239,7 @@ void OLEDDisplayUi::previousFrame() {
     this->state.manuelControll = true;
     this->state.frameState = IN_TRANSITION;
     this->state.ticksSinceLastStateSwitch = 0;
+    this->stateStartPending = true;
     this->lastTransitionDirection = this->state.frameTransitionDirection;
     this->state.frameTransitionDirection = -1;
   }
@@ -161,15 +248,19 @@ void OLEDDisplayUi::previousFrame() {
 void OLEDDisplayUi::switchToFrame(uint8_t frame) {
   if (frame >= this->frameCount) return;
   this->state.ticksSinceLastStateSwitch = 0;
+  this->stateStartPending = true;
   if (frame == this->state.currentFrame) return;
   this->state.frameState = FIXED;
   this->state.currentFrame = frame;
   this->state.isIndicatorDrawen = true;
+  this->cachedFrame = -1;
+  this->invalidate();
 }
 
 void OLEDDisplayUi::transitionToFrame(uint8_t frame) {
   if (frame >= this->frameCount) return;
   this->state.ticksSinceLastStateSwitch = 0;
+  this->stateStartPending = true;
   if (frame == this->state.currentFrame) return;
   this->nextFrameNumber = frame;
   this->lastTransitionDirection = this->state.frameTransitionDirection;
@@ -184,31 +275,124 @@ OLEDDisplayUiState* OLEDDisplayUi::getUiState(){
   return &this->state;
 }
 
+uint32_t OLEDDisplayUi::getDrawnTicks(){
+  return this->drawnTicks;
+}
+
+uint32_t OLEDDisplayUi::getSkippedTicks(){
+  return this->skippedTicks;
+}
+
+uint32_t OLEDDisplayUi::getDrawMicros(){
+  return this->drawMicros;
+}
 
-int8_t OLEDDisplayUi::update(){
-  long frameStart = millis();
-  int8_t timeBudget = this->updateInterval - (frameStart - this->state.lastUpdate);
-  if ( timeBudget <= 0) {
-    // Implement frame skipping to ensure time budget is keept
-    if (this->autoTransition && this->state.lastUpdate != 0) this->state.ticksSinceLastStateSwitch += ceil(-timeBudget / this->updateInterval);
 
-    this->state.lastUpdate = frameStart;
+uint32_t OLEDDisplayUi::getNextDeadline(){
+  uint32_t now = micros();
+  if (this->wakeRequested || this->state.lastUpdate == 0) {
+    return now;
+  }
+  uint32_t deadline = this->lastTickMicros + this->getTickInterval();
+  // Contrast fades step with the calls of update()
+  if (this->display->isFading() && (int32_t) (deadline - now) > FADE_STEP_INTERVAL) {
+    deadline = now + FADE_STEP_INTERVAL;
+  }
+  return deadline;
+}
+
+int16_t OLEDDisplayUi::update(){
+  this->display->stepFade();
+
+  // Until the last frame is sent there is no time to wait for
+  if (this->asyncFlush && this->display->flush()) {
+    return 0;
+  }
+
+  // Unsigned differences stay correct when micros() wraps
+  uint32_t frameStart = micros();
+  uint32_t elapsed = frameStart - this->lastTickMicros;
+  if (this->state.lastUpdate == 0 || this->wakeRequested ||
+      elapsed >= this->getTickInterval() || this->hasNewContent()) {
+    this->wakeRequested = false;
+    this->lastTickMicros = frameStart;
+    this->state.lastUpdate = millis();
     this->tick();
   }
-  return this->updateInterval - (millis() - frameStart);
+  if (this->asyncFlush && this->display->isFlushing()) {
+    return 0;
+  }
+
+  int32_t timeBudget = this->getNextDeadline() - micros();
+  if (timeBudget <= 0) {
+    return 0;
+  }
+  return _min(timeBudget / 1000, (int32_t) 0x7FFF);
+}
+
+uint32_t OLEDDisplayUi::getTickInterval(){
+  if (this->state.frameState != FIXED || this->idleInterval <= this->updateInterval) {
+    return this->updateInterval;
+  }
+  if (this->autoTransition && !this->stateStartPending) {
+    // Start the next transition on time
+    int32_t untilTransition = this->stateStart + this->timePerFrame - this->lastTickMicros;
+    return _min(this->idleInterval, (uint32_t) _max(untilTransition, (int32_t) 0));
+  }
+  return this->idleInterval;
+}
+
+int16_t OLEDDisplayUi::getEasedProgress(uint32_t elapsed){
+  if (elapsed >= this->timePerTransition) return TRANSITION_PROGRESS_END;
+
+  // Scale both times below 2^20 so the position fits 32 bit
+  uint32_t scale = (this->timePerTransition >> 20) + 1;
+  // Position in the table with 8 fractional bits
+  uint16_t position = ((elapsed / scale) << 12) / (this->timePerTransition / scale);
+
+  const int16_t *table;
+  switch (this->transitionEasing) {
+    case EASING_EASE_IN_OUT:
+      table = EASING_EASE_IN_OUT_TABLE;
+      break;
+    case EASING_SPRING:
+      table = EASING_SPRING_TABLE;
+      break;
+    default:
+      return position >> 4;
+  }
+  uint8_t step = position >> 8;
+  int16_t from = pgm_read_word(table + step);
+  int16_t to = pgm_read_word(table + step + 1);
+  return from + (to - from) * (position & 0xFF) / 256;
+}
+
+bool OLEDDisplayUi::hasNewContent(){
+  // Only worth asking while the idle rate holds ticks back
+  if (this->idleInterval <= this->updateInterval || !this->drawnVersionValid) return false;
+  uint32_t version;
+  return this->getContentVersion(&version) && version != this->drawnVersion;
 }
 
 
 void OLEDDisplayUi::tick() {
+  uint32_t tickStart = micros();
   this->state.ticksSinceLastStateSwitch++;
 
+  if (this->stateStartPending) {
+    this->stateStart = tickStart;
+    this->stateStartPending = false;
+  }
+
   switch (this->state.frameState) {
     case IN_TRANSITION:
-        if (this->state.ticksSinceLastStateSwitch >= this->ticksPerTransition){
+        if (tickStart - this->stateStart >= this->timePerTransition){
           this->state.frameState = FIXED;
+          this->stateStart = tickStart;
           this->state.currentFrame = getNextFrameNumber();
           this->state.ticksSinceLastStateSwitch = 0;
           this->nextFrameNumber = -1;
+          this->cachedFrame = -1;
         }
       break;
     case FIXED:
@@ -217,61 +401,161 @@ void OLEDDisplayUi::tick() {
         this->state.frameTransitionDirection = this->lastTransitionDirection;
         this->state.manuelControll = false;
       }
-      if (this->state.ticksSinceLastStateSwitch >= this->ticksPerFrame){
+      if (tickStart - this->stateStart >= this->timePerFrame){
           if (this->autoTransition){
             this->state.frameState = IN_TRANSITION;
           }
+          this->stateStart = tickStart;
           this->state.ticksSinceLastStateSwitch = 0;
       }
       break;
   }
 
+  if (this->state.frameState == IN_TRANSITION) {
+    this->transitionProgress = this->getEasedProgress(tickStart - this->stateStart);
+  }
+
+  // Nothing to do if no frame or overlay changed since the last tick
+  uint32_t version;
+  if (this->getContentVersion(&version)) {
+    if (this->drawnVersionValid && version == this->drawnVersion) {
+      this->skippedTicks++;
+      return;
+    }
+    this->drawnVersion      = version;
+    this->drawnVersionValid = true;
+  } else {
+    this->drawnVersionValid = false;
+  }
+
+  uint32_t drawStart = micros();
+  bool scrolling = this->isHardwareScrolling();
+
+  // Record the tick and skip it if it draws what is shown already
+  bool replay = false;
+  if (this->screenList.isEnabled() && this->state.frameState == FIXED &&
+      this->state.currentFrame != this->unrecordedFrame) {
+    this->display->beginRecording(&this->screenList);
+    this->drawScreen(scrolling);
+    replay = this->display->endRecording();
+    // Recording it again next tick would only draw it twice again
+    if (!replay) this->unrecordedFrame = this->state.currentFrame;
+  }
+  if (replay && this->drawnListValid &&
+      this->screenList.getHash() == this->drawnListHash && this->screenList.getLength() == this->drawnListLength &&
+      millis() - this->drawnListTime < OLEDDISPLAY_LIST_REFRESH * 1000UL) {
+    this->drawMicros += micros() - drawStart;
+    this->skippedTicks++;
+    return;
+  }
+  this->drawnListTime   = millis();
+  this->drawnListValid  = replay;
+  this->drawnListHash   = this->screenList.getHash();
+  this->drawnListLength = this->screenList.getLength();
+
+  #ifdef OLEDDISPLAY_BANDED
+  // Every band is sent as soon as it is drawn
+  this->display->firstBand();
+  do {
+    if (replay) {
+      this->display->replay(&this->screenList);
+    } else {
+      this->drawScreen(scrolling);
+    }
+  } while (this->display->nextBand());
+  #else
   this->display->clear();
-  this->drawFrame();
-  if (shouldDrawIndicators) {
-    this->drawIndicator();
+  if (replay) {
+    this->display->replay(&this->screenList);
+  } else {
+    this->drawScreen(scrolling);
   }
-  this->drawOverlays();
-  this->display->display();
+  if (this->asyncFlush) {
+    this->display->displayAsync();
+  } else {
+    this->display->display();
+  }
+  #endif
+
+  uint8_t line = scrolling ? this->scrollLine : 0;
+  if (line != this->startLine) {
+    this->display->setStartLine(line);
+    this->startLine = line;
+  }
+
+  this->drawMicros += micros() - drawStart;
+  this->drawnTicks++;
+}
+
+bool OLEDDisplayUi::getContentVersion(uint32_t *version) {
+  if (this->state.frameState != FIXED || !this->frameVersionFunctions) return false;
+  if (this->overlayCount > 0 && !this->overlayVersionFunctions) return false;
+
+  uint32_t result = this->state.currentFrame;
+  result = result * 31 + (this->frameVersionFunctions[this->state.currentFrame])(&this->state);
+  for (uint8_t i = 0; i < this->overlayCount; i++) {
+    result = result * 31 + (this->overlayVersionFunctions[i])(&this->state);
+  }
+  *version = result;
+  return true;
 }
 
 void OLEDDisplayUi::resetState() {
+  this->cachedFrame = -1;
+  this->drawnVersionValid = false;
+  this->drawnListValid = false;
+  this->unrecordedFrame = -1;
   this->state.lastUpdate = 0;
   this->state.ticksSinceLastStateSwitch = 0;
+  this->stateStartPending = true;
   this->state.frameState = FIXED;
   this->state.currentFrame = 0;
   this->state.isIndicatorDrawen = true;
 }
 
+void OLEDDisplayUi::drawScreen(bool scrolling){
+  this->drawFrame();
+  if (scrolling) return;
+  if (shouldDrawIndicators) {
+    this->drawIndicator();
+  }
+  this->drawOverlays();
+}
+
 void OLEDDisplayUi::drawFrame(){
   switch (this->state.frameState){
      case IN_TRANSITION: {
-       float progress = (float) this->state.ticksSinceLastStateSwitch / (float) this->ticksPerTransition;
+       if (this->isHardwareScrolling()) {
+         this->drawScrolledFrames();
+         break;
+       }
+
+       int16_t progress = this->transitionProgress;
        int16_t x, y, x1, y1;
        switch(this->frameAnimationDirection){
         case SLIDE_LEFT:
-          x = -128 * progress;
+          x = -DISPLAY_WIDTH * progress / TRANSITION_PROGRESS_END;
           y = 0;
-          x1 = x + 128;
+          x1 = x + DISPLAY_WIDTH;
           y1 = 0;
           break;
         case SLIDE_RIGHT:
-          x = 128 * progress;
+          x = DISPLAY_WIDTH * progress / TRANSITION_PROGRESS_END;
           y = 0;
-          x1 = x - 128;
+          x1 = x - DISPLAY_WIDTH;
           y1 = 0;
           break;
         case SLIDE_UP:
           x = 0;
-          y = -64 * progress;
+          y = -DISPLAY_HEIGHT * progress / TRANSITION_PROGRESS_END;
           x1 = 0;
-          y1 = y + 64;
+          y1 = y + DISPLAY_HEIGHT;
           break;
         case SLIDE_DOWN:
           x = 0;
-          y = 64 * progress;
+          y = DISPLAY_HEIGHT * progress / TRANSITION_PROGRESS_END;
           x1 = 0;
-          y1 = y - 64;
+          y1 = y - DISPLAY_HEIGHT;
           break;
        }
 
@@ -281,14 +565,30 @@ void OLEDDisplayUi::drawFrame(){
 
        bool drawenCurrentFrame;
 
-
-       // Prope each frameFunction for the indicator Drawen state
-       this->enableIndicator();
-       (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, x, y);
-       drawenCurrentFrame = this->state.isIndicatorDrawen;
-
-       this->enableIndicator();
-       (this->frameFunctions[this->getNextFrameNumber()])(this->display, &this->state, x1, y1);
+       if (this->transitionBuffer) {
+         uint8_t nextFrame = this->getNextFrameNumber();
+         if (this->cachedFrame != this->state.currentFrame || this->cachedNextFrame != nextFrame) {
+           this->cacheTransitionFrames(this->state.currentFrame, nextFrame);
+         }
+
+         this->display->setColor(WHITE);
+         this->display->drawPageBuffer(x, y, this->transitionBuffer);
+         this->display->drawPageBuffer(x1, y1, this->transitionBuffer + DISPLAY_BUFFER_SIZE);
+
+         drawenCurrentFrame = this->cachedFrameIndicator;
+         this->state.isIndicatorDrawen = this->cachedNextFrameIndicator;
+       #ifdef OLEDDISPLAY_REDUCE_MEMORY
+       } else if (this->drawRecordedFrames(x, y, x1, y1)) {
+         drawenCurrentFrame = this->cachedFrameIndicator;
+         this->state.isIndicatorDrawen = this->cachedNextFrameIndicator;
+       #endif
+       } else {
+         // Prope each frameFunction for the indicator Drawen state
+         this->drawFrameAt(this->state.currentFrame, x, y, &this->cachedFrameIndicator);
+         drawenCurrentFrame = this->cachedFrameIndicator;
+
+         this->drawFrameAt(this->getNextFrameNumber(), x1, y1, &this->cachedNextFrameIndicator);
+       }
 
        // Build up the indicatorDrawState
        if (drawenCurrentFrame && !this->state.isIndicatorDrawen) {
@@ -312,12 +612,119 @@ void OLEDDisplayUi::drawFrame(){
       // Always assume that the indicator is drawn!
       // And set indicatorDrawState to "not known yet"
       this->indicatorDrawState = 0;
-      this->enableIndicator();
-      (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, 0, 0);
+      this->drawFrameAt(this->state.currentFrame, 0, 0, &this->cachedFrameIndicator);
       break;
   }
 }
 
+void OLEDDisplayUi::drawFrameAt(uint8_t frame, int16_t x, int16_t y, bool *indicator) {
+  if (this->frameBoundsFunctions) {
+    OLEDDisplayRect bounds = (this->frameBoundsFunctions[frame])(&this->state);
+    if (!this->display->isVisible(x + bounds.x, y + bounds.y, bounds.width, bounds.height)) {
+      // The frame asked for the same indicator state when it was drawn last
+      this->state.isIndicatorDrawen = *indicator;
+      return;
+    }
+  }
+  // During a transition the part of the frame that moved off the screen
+  // (or onto the other frame) is rejected before any glyph is read
+  bool clipped = this->display->pushClip(x, y, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  this->enableIndicator();
+  (this->frameFunctions[frame])(this->display, &this->state, x, y);
+  *indicator = this->state.isIndicatorDrawen;
+  if (clipped) this->display->popClip();
+}
+
+#ifdef OLEDDISPLAY_REDUCE_MEMORY
+bool OLEDDisplayUi::drawRecordedFrames(int16_t x, int16_t y, int16_t x1, int16_t y1) {
+  if (!this->frameLists[0].isEnabled()) return false;
+
+  uint8_t nextFrame = this->getNextFrameNumber();
+  if (this->cachedFrame != this->state.currentFrame || this->cachedNextFrame != nextFrame) {
+    // Prope each frameFunction for the indicator Drawen state
+    this->display->beginRecording(&this->frameLists[0]);
+    this->enableIndicator();
+    (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, 0, 0);
+    this->cachedFrameIndicator = this->state.isIndicatorDrawen;
+    this->display->endRecording();
+
+    this->display->beginRecording(&this->frameLists[1]);
+    this->enableIndicator();
+    (this->frameFunctions[nextFrame])(this->display, &this->state, 0, 0);
+    this->cachedNextFrameIndicator = this->state.isIndicatorDrawen;
+    this->display->endRecording();
+
+    this->cachedFrame     = this->state.currentFrame;
+    this->cachedNextFrame = nextFrame;
+  }
+  if (!this->frameLists[0].isValid() || !this->frameLists[1].isValid()) return false;
+
+  this->replayFrameAt(&this->frameLists[0], x, y);
+  this->replayFrameAt(&this->frameLists[1], x1, y1);
+  return true;
+}
+
+void OLEDDisplayUi::replayFrameAt(OLEDDisplayList *list, int16_t x, int16_t y) {
+  bool clipped = this->display->pushClip(x, y, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  this->display->replay(list, x, y);
+  if (clipped) this->display->popClip();
+}
+#endif
+
+bool OLEDDisplayUi::isHardwareScrolling() {
+  // The start line wraps around the 64 rows of the display RAM
+  return DISPLAY_HEIGHT == 64 &&
+         this->hardwareScroll && this->transitionBuffer && this->state.frameState == IN_TRANSITION &&
+         (this->frameAnimationDirection == SLIDE_UP || this->frameAnimationDirection == SLIDE_DOWN);
+}
+
+void OLEDDisplayUi::drawScrolledFrames() {
+  uint8_t nextFrame = this->getNextFrameNumber();
+  if (this->cachedFrame != this->state.currentFrame || this->cachedNextFrame != nextFrame) {
+    this->cacheTransitionFrames(this->state.currentFrame, nextFrame);
+  }
+  const uint8_t *current = this->transitionBuffer;
+  const uint8_t *next    = this->transitionBuffer + DISPLAY_BUFFER_SIZE;
+
+  // Rows the frames moved, the overshoot of a spring can't be shown
+  int16_t rows = DISPLAY_HEIGHT * this->transitionProgress / TRANSITION_PROGRESS_END;
+  rows = max((int16_t) 0, min(rows, (int16_t) DISPLAY_HEIGHT));
+
+  // The display shows RAM row (row + start line) % DISPLAY_HEIGHT in each
+  // row. Both frames keep their rows in the RAM and every tick only hands
+  // the rows that scrolled in from the current to the next frame.
+  bool up = (this->frameAnimationDirection == SLIDE_UP) == (this->state.frameTransitionDirection >= 0);
+  if (up) {
+    this->display->copyPageRows(next, 0, rows);
+    this->display->copyPageRows(current, rows, DISPLAY_HEIGHT - rows);
+    this->scrollLine = rows % DISPLAY_HEIGHT;
+  } else {
+    this->display->copyPageRows(current, 0, DISPLAY_HEIGHT - rows);
+    this->display->copyPageRows(next, DISPLAY_HEIGHT - rows, rows);
+    this->scrollLine = (DISPLAY_HEIGHT - rows) % DISPLAY_HEIGHT;
+  }
+
+  this->state.isIndicatorDrawen = this->cachedNextFrameIndicator;
+}
+
+void OLEDDisplayUi::cacheTransitionFrames(uint8_t frame, uint8_t nextFrame) {
+  // Prope each frameFunction for the indicator Drawen state
+  this->display->beginOffscreen(this->transitionBuffer);
+  this->enableIndicator();
+  (this->frameFunctions[frame])(this->display, &this->state, 0, 0);
+  this->cachedFrameIndicator = this->state.isIndicatorDrawen;
+  this->display->endOffscreen();
+
+  this->display->beginOffscreen(this->transitionBuffer + DISPLAY_BUFFER_SIZE);
+  this->enableIndicator();
+  (this->frameFunctions[nextFrame])(this->display, &this->state, 0, 0);
+  this->cachedNextFrameIndicator = this->state.isIndicatorDrawen;
+  this->display->endOffscreen();
+
+  this->cachedFrame     = frame;
+  this->cachedNextFrame = nextFrame;
+}
+
 void OLEDDisplayUi::drawIndicator() {
 
     // Only draw if the indicator is invisible
@@ -328,7 +735,8 @@ void OLEDDisplayUi::drawIndicator() {
     }
 
     uint8_t posOfHighlightFrame;
-    float indicatorFadeProgress = 0;
+    // Pixels the indicator is moved out of the screen
+    int16_t indicatorFade = 0;
 
     // if the indicator needs to be slided in we want to
     // highlight the next frame in the transition
@@ -348,11 +756,11 @@ void OLEDDisplayUi::drawIndicator() {
     switch (this->indicatorDrawState) {
       case 1: // Indicator was not drawn in this frame but will be in next
         // Slide IN
-        indicatorFadeProgress = 1 - ((float) this->state.ticksSinceLastStateSwitch / (float) this->ticksPerTransition);
+        indicatorFade = 8 * (TRANSITION_PROGRESS_END - this->transitionProgress) / TRANSITION_PROGRESS_END;
         break;
       case 2: // Indicator was drawn in this frame but not in next
         // Slide OUT
-        indicatorFadeProgress = ((float) this->state.ticksSinceLastStateSwitch / (float) this->ticksPerTransition);
+        indicatorFade = 8 * this->transitionProgress / TRANSITION_PROGRESS_END;
         break;
     }
 
@@ -363,20 +771,20 @@ void OLEDDisplayUi::drawIndicator() {
 
       switch (this->indicatorPosition){
         case TOP:
-          y = 0 - (8 * indicatorFadeProgress);
-          x = 64 - frameStartPos + 12 * i;
+          y = 0 - indicatorFade;
+          x = DISPLAY_WIDTH / 2 - frameStartPos + 12 * i;
           break;
         case BOTTOM:
-          y = 56 + (8 * indicatorFadeProgress);
-          x = 64 - frameStartPos + 12 * i;
+          y = DISPLAY_HEIGHT - 8 + indicatorFade;
+          x = DISPLAY_WIDTH / 2 - frameStartPos + 12 * i;
           break;
         case RIGHT:
-          x = 120 + (8 * indicatorFadeProgress);
-          y = 32 - frameStartPos + 12 * i;
+          x = DISPLAY_WIDTH - 8 + indicatorFade;
+          y = DISPLAY_HEIGHT / 2 - frameStartPos + 12 * i;
           break;
         case LEFT:
-          x = 0 - (8 * indicatorFadeProgress);
-          y = 32 - frameStartPos + 12 * i;
+          x = 0 - indicatorFade;
+          y = DISPLAY_HEIGHT / 2 - frameStartPos + 12 * i;
           break;
       }
 
@@ -392,6 +800,10 @@ void OLEDDisplayUi::drawIndicator() {
 
 void OLEDDisplayUi::drawOverlays() {
  for (uint8_t i=0;i<this->overlayCount;i++){
+    if (this->overlayBoundsFunctions) {
+      OLEDDisplayRect bounds = (this->overlayBoundsFunctions[i])(&this->state);
+      if (!this->display->isVisible(bounds.x, bounds.y, bounds.width, bounds.height)) continue;
+    }
     (this->overlayFunctions[i])(this->display, &this->state);
  }
 }
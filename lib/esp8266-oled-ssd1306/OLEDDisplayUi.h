@@ -43,6 +43,22 @@ enum AnimationDirection {
   SLIDE_RIGHT
 };
 
+enum TransitionEasing {
+  EASING_LINEAR,
+  EASING_EASE_IN_OUT,
+  EASING_SPRING
+};
+
+// Transition progress is fixed point, this is the end of a transition.
+// EASING_SPRING overshoots it before settling.
+#define TRANSITION_PROGRESS_END 256
+
+// A skipped tick whose display list hash collided with the last drawn
+// one leaves the screen stale until the next full redraw (seconds)
+#ifndef OLEDDISPLAY_LIST_REFRESH
+#define OLEDDISPLAY_LIST_REFRESH 60
+#endif
+
 enum IndicatorPosition {
   TOP,
   RIGHT,
@@ -98,6 +114,14 @@ typedef void (*FrameCallback)(OLEDDisplay *display,  OLEDDisplayUiState* state,
 typedef void (*OverlayCallback)(OLEDDisplay *display,  OLEDDisplayUiState* state);
 typedef void (*LoadingDrawFunction)(OLEDDisplay *display, LoadingStage* stage, uint8_t progress);
 
+// Returns a number that changes whenever the frame or overlay
+// would draw something different
+typedef uint32_t (*VersionCallback)(OLEDDisplayUiState* state);
+
+// Returns the rectangle the frame (relative to its x/y) or the overlay
+// draws into. Bands and clips it doesn't reach skip its callback.
+typedef OLEDDisplayRect (*BoundsCallback)(OLEDDisplayUiState* state);
+
 class OLEDDisplayUi {
   private:
     OLEDDisplay             *display;
@@ -116,12 +140,21 @@ class OLEDDisplayUi {
 
     int8_t              lastTransitionDirection   = 1;
 
-    uint16_t            ticksPerFrame             = 151; // ~ 5000ms at 30 FPS
-    uint16_t            ticksPerTransition        = 15;  // ~  500ms at 30 FPS
+    // Frames and transitions run on elapsed time, independent of the
+    // ticks. After a state switch outside of a tick its clock starts
+    // with the next tick.
+    uint32_t            timePerFrame              = 5000000; // µs
+    uint32_t            timePerTransition         = 500000;  // µs
+    uint32_t            stateStart                = 0;
+    bool                stateStartPending         = true;
+    TransitionEasing    transitionEasing          = EASING_LINEAR;
+    int16_t             transitionProgress        = 0;
 
     bool                autoTransition            = true;
 
     FrameCallback*      frameFunctions;
+    VersionCallback*    frameVersionFunctions     = NULL;
+    BoundsCallback*     frameBoundsFunctions      = NULL;
     uint8_t             frameCount                = 0;
 
     // Internally used to transition to a specific frame
@@ -129,8 +162,20 @@ class OLEDDisplayUi {
 
     // Values for Overlays
     OverlayCallback*    overlayFunctions;
+    VersionCallback*    overlayVersionFunctions   = NULL;
+    BoundsCallback*     overlayBoundsFunctions    = NULL;
     uint8_t             overlayCount              = 0;
 
+    // Content version of the last drawn tick, a tick with
+    // the same version is skipped
+    uint32_t            drawnVersion              = 0;
+    bool                drawnVersionValid         = false;
+
+    // Statistics
+    uint32_t            drawnTicks                = 0;
+    uint32_t            skippedTicks              = 0;
+    uint32_t            drawMicros                = 0;
+
     // Will the Indicator be drawen
     // 3 Not drawn in both frames
     // 2 Drawn this frame but not next
@@ -142,21 +187,76 @@ class OLEDDisplayUi {
     LoadingDrawFunction loadingDrawFunction       = [](OLEDDisplay *display, LoadingStage* stage, uint8_t progress) {
       display->setTextAlignment(TEXT_ALIGN_CENTER);
       display->setFont(ArialMT_Plain_10);
-      display->drawString(64, 18, stage->process);
-      display->drawProgressBar(4, 32, 120, 8, progress);
+      display->drawString(DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 2 - 14, stage->process);
+      display->drawProgressBar(4, DISPLAY_HEIGHT / 2, DISPLAY_WIDTH - 8, 8, progress);
     };
 
     // UI State
     OLEDDisplayUiState      state;
 
-    // Bookeeping for update
-    uint8_t             updateInterval            = 33;
+    // Bookeeping for update, all times in µs. A FIXED frame is ticked
+    // every idleInterval when that is longer than updateInterval.
+    uint32_t            updateInterval            = 33333;
+    uint32_t            idleInterval              = 0;
+    uint32_t            lastTickMicros            = 0;
+    volatile bool       wakeRequested             = false;
+
+    // Send frames in steps from update()
+    bool                asyncFlush                = false;
+
+    // The outgoing and the incoming frame of a transition are drawn once
+    // into these page buffers, every tick of it only moves them.
+    // cachedFrame is -1 while they hold nothing. The indicator state of
+    // a frame is also kept for the bands that skip its callback.
+    uint8_t            *transitionBuffer          = NULL;
+    #if defined(OLEDDISPLAY_STATIC_BUFFER) && !defined(OLEDDISPLAY_REDUCE_MEMORY)
+    uint8_t             transitionStorage[DISPLAY_BUFFER_SIZE * 2];
+    #endif
+    int8_t              cachedFrame               = -1;
+    int8_t              cachedNextFrame           = -1;
+    bool                cachedFrameIndicator      = true;
+    bool                cachedNextFrameIndicator  = true;
+
+    // With display lists a FIXED tick is recorded first and only drawn if
+    // it differs from the last drawn one. Without the transition cache
+    // the two frames of a transition are recorded once and replayed.
+    // unrecordedFrame is the frame whose ticks didn't fit into the list,
+    // it is drawn directly until the frames or overlays change.
+    OLEDDisplayList     screenList;
+    uint32_t            drawnListHash             = 0;
+    uint16_t            drawnListLength           = 0;
+    bool                drawnListValid            = false;
+    uint32_t            drawnListTime             = 0;
+    int8_t              unrecordedFrame           = -1;
+    #ifdef OLEDDISPLAY_REDUCE_MEMORY
+    OLEDDisplayList     frameLists[2];
+    #endif
+
+    // Vertical transitions move the display start line instead of the
+    // frames. scrollLine is the line of the current tick, startLine the
+    // one the display shows.
+    bool                hardwareScroll            = false;
+    uint8_t             scrollLine                = 0;
+    uint8_t             startLine                 = 0;
 
     uint8_t             getNextFrameNumber();
     void                drawIndicator();
+    void                drawScreen(bool scrolling);
     void                drawFrame();
+    void                drawFrameAt(uint8_t frame, int16_t x, int16_t y, bool *indicator);
+    bool                isHardwareScrolling();
+    void                drawScrolledFrames();
+    void                cacheTransitionFrames(uint8_t frame, uint8_t nextFrame);
+    #ifdef OLEDDISPLAY_REDUCE_MEMORY
+    bool                drawRecordedFrames(int16_t x, int16_t y, int16_t x1, int16_t y1);
+    void                replayFrameAt(OLEDDisplayList *list, int16_t x, int16_t y);
+    #endif
     void                drawOverlays();
     void                tick();
+    bool                getContentVersion(uint32_t *version);
+    bool                hasNewContent();
+    int16_t             getEasedProgress(uint32_t elapsed);
+    uint32_t            getTickInterval();
     void                resetState();
 
   public:
@@ -164,15 +264,45 @@ class OLEDDisplayUi {
     OLEDDisplayUi(OLEDDisplay *display);
 
     /**
-     * Initialise the display
+     * Initialise the display, returns false if that failed.
+     * Safe to call again.
      */
-    void init();
+    bool init();
 
     /**
      * Configure the internal used target FPS
      */
     void setTargetFPS(uint8_t fps);
 
+    /**
+     * Tick a FIXED frame only `fps` times a second, transitions still run
+     * at the target FPS. A changed frame or overlay version or `wake()`
+     * ticks right away. 0 disables the idle rate.
+     */
+    void setIdleFPS(uint8_t fps);
+
+    /**
+     * Tick on the next call of `update()`, e.g. after input
+     */
+    void wake();
+
+    /**
+     * Send frames with `displayAsync()` and push their pages from `update()`.
+     * The next frame is drawn once the last one is completely sent.
+     */
+    void enableAsyncFlush();
+    void disableAsyncFlush();
+
+    /**
+     * Run SLIDE_UP and SLIDE_DOWN transitions by moving the display start
+     * line, so only the rows a tick exposes are sent. Overlays and the
+     * indicator are hidden during these transitions. Needs the transition
+     * cache, which OLEDDISPLAY_REDUCE_MEMORY leaves out, and a panel with
+     * all 64 rows of the display RAM.
+     */
+    void enableHardwareScroll();
+    void disableHardwareScroll();
+
     // Automatic Controll
     /**
      * Enable automatic transition to next frame after the some time can be configured with `setTimePerFrame` and `setTimePerTransition`.
@@ -256,16 +386,44 @@ class OLEDDisplayUi {
     void setFrameAnimation(AnimationDirection dir);
 
     /**
-     * Add frame drawing functions
+     * Configure how the frames and the indicator move during a transition
+     */
+    void setTransitionEasing(TransitionEasing easing);
+
+    /**
+     * Add frame drawing functions. With `versionFunctions` (one per frame)
+     * a FIXED frame is only drawn again when its version or the version
+     * of an overlay changed. With `boundsFunctions` (one per frame) a frame
+     * is only drawn into the bands (OLEDDISPLAY_BANDED) it reaches and not
+     * at all while a transition moved it off the screen.
      */
-    void setFrames(FrameCallback* frameFunctions, uint8_t frameCount);
+    void setFrames(FrameCallback* frameFunctions, uint8_t frameCount, VersionCallback* versionFunctions = NULL, BoundsCallback* boundsFunctions = NULL);
 
     // Overlay
 
     /**
-     * Add overlays drawing functions that are draw independent of the Frames
+     * Add overlays drawing functions that are draw independent of the Frames.
+     * Without `versionFunctions` (one per overlay) every tick is drawn.
+     * `boundsFunctions` work like the ones of the frames.
      */
-    void setOverlays(OverlayCallback* overlayFunctions, uint8_t overlayCount);
+    void setOverlays(OverlayCallback* overlayFunctions, uint8_t overlayCount, VersionCallback* versionFunctions = NULL, BoundsCallback* boundsFunctions = NULL);
+
+    /**
+     * Record every tick into a display list of up to `size` bytes first.
+     * A FIXED tick that records the same commands as the last drawn one is
+     * skipped, even without version functions. Frames that draw images
+     * from RAM, or don't fit into the list, are drawn directly. Without the
+     * transition cache (OLEDDISPLAY_REDUCE_MEMORY) both frames of a transition are
+     * recorded once and then replayed at their positions, on every tick
+     * and in every band. 0 disables the lists.
+     */
+    bool setDisplayListSize(uint16_t size);
+
+    /**
+     * Draw the next tick even if no version changed, e.g. after
+     * drawing to the display outside of the Ui.
+     */
+    void invalidate();
 
 
     // Loading animation
@@ -300,6 +458,22 @@ class OLEDDisplayUi {
     // State Info
     OLEDDisplayUiState* getUiState();
 
-    int8_t update();
+    /**
+     * Ticks that were drawn, ticks that were skipped because nothing
+     * changed and the time spent drawing in µs
+     */
+    uint32_t getDrawnTicks();
+    uint32_t getSkippedTicks();
+    uint32_t getDrawMicros();
+
+    /**
+     * Time of the next tick in `micros()`
+     */
+    uint32_t getNextDeadline();
+
+    /**
+     * Ticks when due and returns the milliseconds until the next tick
+     */
+    int16_t update();
 };
 #endif
@@ -29,6 +29,10 @@
 #define SH1106Brzo_h
 
 #include "OLEDDisplay.h"
+
+#ifdef OLEDDISPLAY_BANDED
+#error "OLEDDISPLAY_BANDED sends the bands with sendData(), which only SSD1306Wire and SH1106Wire implement"
+#endif
 #include <brzo_i2c.h>
 
 #if F_CPU == 160000000L
@@ -56,42 +60,22 @@ class SH1106Brzo : public OLEDDisplay {
     }
 
     void display(void) {
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = ~0;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = ~0;
-       uint8_t maxBoundX = 0;
+    #ifdef OLEDDISPLAY_DIFF
+       uint8_t minBoundY, maxBoundY;
+       uint8_t minBoundX, maxBoundX;
        uint8_t x, y;
 
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (DISPLAY_HEIGHT / 8); y++) {
-         for (x = 0; x < DISPLAY_WIDTH; x++) {
-          uint16_t pos = x + y * DISPLAY_WIDTH;
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == ~0) return;
+       // Compare (and copy to buffer_back) only the columns
+       // the drawing functions touched since the last display()
+       if (!collectChanges(minBoundX, maxBoundX, minBoundY, maxBoundY)) return;
 
        byte k = 0;
        uint8_t sendBuffer[17];
        sendBuffer[0] = 0x40;
 
        // Calculate the colum offset 
-       uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-       uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
+       uint8_t minBoundXp2H = (minBoundX + SH1106_COLUMN_OFFSET) & 0x0F;
+       uint8_t minBoundXp2L = 0x10 | ((minBoundX + SH1106_COLUMN_OFFSET) >> 4 );
 
        brzo_i2c_start_transaction(this->_address, BRZO_I2C_SPEED);
 
@@ -35,6 +35,21 @@
 #define SH1106_SET_PUMP_MODE 0XAD
 #define SH1106_PUMP_ON 0X8B
 #define SH1106_PUMP_OFF 0X8A
+
+// A run of data starts a new transmission with page and column setup
+// (address, 3 x 0x80 + command, 0x40): 8 bytes. Changed runs that are at
+// most this many columns apart are sent as one.
+#define SH1106_SPAN_MERGE_GAP 8
+
+// Control bytes: a stream of commands, a stream of data, one command
+#define SH1106_CONTROL_COMMANDS 0x00
+#define SH1106_CONTROL_DATA     0x40
+#define SH1106_CONTROL_COMMAND  0x80
+#define SH1106_CONTROL_NONE     0xFF
+
+#ifndef BUFFER_LENGTH
+#define BUFFER_LENGTH 32
+#endif
 //--------------------------------------
 
 class SH1106Wire : public OLEDDisplay {
@@ -48,6 +63,9 @@ class SH1106Wire : public OLEDDisplay {
       this->_address = _address;
       this->_sda = _sda;
       this->_scl = _scl;
+      #ifdef OLEDDISPLAY_DIFF
+      this->spanMergeGap = SH1106_SPAN_MERGE_GAP;
+      #endif
     }
 
     bool connect() {
@@ -59,93 +77,96 @@ class SH1106Wire : public OLEDDisplay {
     }
 
     void display(void) {
-      #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundY = ~0;
-        uint8_t maxBoundY = 0;
-
-        uint8_t minBoundX = ~0;
-        uint8_t maxBoundX = 0;
-
-        uint8_t x, y;
-
-        // Calculate the Y bounding box of changes
-        // and copy buffer[pos] to buffer_back[pos];
-        for (y = 0; y < (DISPLAY_HEIGHT / 8); y++) {
-          for (x = 0; x < DISPLAY_WIDTH; x++) {
-           uint16_t pos = x + y * DISPLAY_WIDTH;
-           if (buffer[pos] != buffer_back[pos]) {
-             minBoundY = _min(minBoundY, y);
-             maxBoundY = _max(maxBoundY, y);
-             minBoundX = _min(minBoundX, x);
-             maxBoundX = _max(maxBoundX, x);
-           }
-           buffer_back[pos] = buffer[pos];
-         }
-         yield();
-        }
-
-        // If the minBoundY wasn't updated
-        // we can savely assume that buffer_back[pos] == buffer[pos]
-        // holdes true for all values of pos
-        if (minBoundY == ~0) return;
-
-        // Calculate the colum offset
-        uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-        uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
-
-        byte k = 0;
-        for (y = minBoundY; y <= maxBoundY; y++) {
-          sendCommand(0xB0 + y);
-          sendCommand(minBoundXp2H);
-          sendCommand(minBoundXp2L);
-          for (x = minBoundX; x <= maxBoundX; x++) {
-            if (k == 0) {
-              Wire.beginTransmission(_address);
-              Wire.write(0x40);
-            }
-            Wire.write(buffer[x + y * DISPLAY_WIDTH]);
-            k++;
-            if (k == 16)  {
-              Wire.endTransmission();
-              k = 0;
-            }
-          }
-          if (k != 0)  {
-            Wire.endTransmission();
-            k = 0;
-          }
-          yield();
-        }
-
-        if (k != 0) {
-          Wire.endTransmission();
-        }
+      #ifdef OLEDDISPLAY_BANDED
+        sendBand();
+      #elif defined(OLEDDISPLAY_DOUBLE_BUFFER)
+        // Send each run of changed columns with its own page and column
+        // address, unless the gap to the next run is cheaper to resend
+        takeSnapshot();
+        sendPendingPages(DISPLAY_HEIGHT / 8, 0);
+      #elif defined(OLEDDISPLAY_HASH_DIFF)
+        sendChangedSpans();
       #else
-        uint8_t * p = &buffer[0];
-        for (uint8_t y=0; y<8; y++) {
-          sendCommand(0xB0+y);
-          sendCommand(0x02);
-          sendCommand(0x10);
-          for( uint8_t x=0; x<8; x++) {
-            Wire.beginTransmission(_address);
-            Wire.write(0x40);
-            for (uint8_t k = 0; k < 16; k++) {
-              Wire.write(*p++);
-            }
-            Wire.endTransmission();
-          }
+        this->frameBytes = 0;
+        for (uint8_t y = 0; y < (DISPLAY_HEIGHT / 8); y++) {
+          sendData(y, 0, buffer + y * DISPLAY_WIDTH, DISPLAY_WIDTH);
         }
       #endif
     }
 
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    void displayAsync(void) {
+      takeSnapshot();
+    }
+    #endif
+
   private:
-    inline void sendCommand(uint8_t command) __attribute__((always_inline)){
+    // Control byte of the open transmission and the bytes it holds
+    uint8_t _txControl = SH1106_CONTROL_NONE;
+    uint8_t _txLength  = 0;
+
+    void beginTransmission(uint8_t control) {
       Wire.beginTransmission(_address);
-      Wire.write(0x80);
-      Wire.write(command);
+      Wire.write(control);
+      this->_txControl = control;
+      this->_txLength = 1;
+      this->frameBytes += 2;
+    }
+
+    void endTransmission() {
+      if (this->_txControl == SH1106_CONTROL_NONE) return;
       Wire.endTransmission();
+      this->_txControl = SH1106_CONTROL_NONE;
+    }
+
+    // Commands are collected into one command stream
+    // until the Wire buffer is full or data follows
+    inline void sendCommand(uint8_t command) __attribute__((always_inline)){
+      if (this->_txControl != SH1106_CONTROL_COMMANDS || this->_txLength == BUFFER_LENGTH) {
+        endTransmission();
+        beginTransmission(SH1106_CONTROL_COMMANDS);
+      }
+      Wire.write(command);
+      this->_txLength++;
+      this->frameBytes++;
     }
 
+    void flushCommands() {
+      endTransmission();
+    }
+
+    // Writes `length` bytes to `page` starting at `column`. The page and
+    // column commands travel in the same transmission as the first data.
+    void sendData(uint8_t page, uint8_t column, const uint8_t *data, uint8_t length) {
+      column += SH1106_COLUMN_OFFSET;
+
+      endTransmission();
+      Wire.beginTransmission(_address);
+      Wire.write(SH1106_CONTROL_COMMAND);
+      Wire.write(0xB0 + page);
+      Wire.write(SH1106_CONTROL_COMMAND);
+      Wire.write(SETLOWCOLUMN | (column & 0x0F));
+      Wire.write(SH1106_CONTROL_COMMAND);
+      Wire.write(SETHIGHCOLUMN | (column >> 4));
+      Wire.write(SH1106_CONTROL_DATA);
+      this->_txControl = SH1106_CONTROL_DATA;
+      this->_txLength = 7;
+      this->frameBytes += 8;
+
+      while (length > 0) {
+        if (this->_txLength == BUFFER_LENGTH) {
+          endTransmission();
+          beginTransmission(SH1106_CONTROL_DATA);
+        }
+        uint8_t chunk = _min(length, BUFFER_LENGTH - this->_txLength);
+        Wire.write(data, chunk);
+        data += chunk;
+        length -= chunk;
+        this->_txLength += chunk;
+        this->frameBytes += chunk;
+      }
+      endTransmission();
+    }
 
 };
 
@@ -29,6 +29,14 @@
 #define SSD1306Brzo_h
 
 #include "OLEDDisplay.h"
+
+#if SSD1306_COLUMN_OFFSET < 0
+#error "The SSD1306 has 128 columns"
+#endif
+
+#ifdef OLEDDISPLAY_BANDED
+#error "OLEDDISPLAY_BANDED sends the bands with sendData(), which only SSD1306Wire and SH1106Wire implement"
+#endif
 #include <brzo_i2c.h>
 
 #if F_CPU == 160000000L
@@ -56,39 +64,18 @@ class SSD1306Brzo : public OLEDDisplay {
     }
 
     void display(void) {
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = ~0;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = ~0;
-       uint8_t maxBoundX = 0;
-
+    #ifdef OLEDDISPLAY_DIFF
+       uint8_t minBoundY, maxBoundY;
+       uint8_t minBoundX, maxBoundX;
        uint8_t x, y;
 
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (DISPLAY_HEIGHT / 8); y++) {
-         for (x = 0; x < DISPLAY_WIDTH; x++) {
-          uint16_t pos = x + y * DISPLAY_WIDTH;
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == ~0) return;
+       // Compare (and copy to buffer_back) only the columns
+       // the drawing functions touched since the last display()
+       if (!collectChanges(minBoundX, maxBoundX, minBoundY, maxBoundY)) return;
 
        sendCommand(COLUMNADDR);
-       sendCommand(minBoundX);
-       sendCommand(maxBoundX);
+       sendCommand(SSD1306_COLUMN_OFFSET + minBoundX);
+       sendCommand(SSD1306_COLUMN_OFFSET + maxBoundX);
 
        sendCommand(PAGEADDR);
        sendCommand(minBoundY);
@@ -114,12 +101,12 @@ class SSD1306Brzo : public OLEDDisplay {
      #else
        // No double buffering
        sendCommand(COLUMNADDR);
-       sendCommand(0x0);
-       sendCommand(0x7F);
+       sendCommand(SSD1306_COLUMN_OFFSET);
+       sendCommand(SSD1306_COLUMN_OFFSET + DISPLAY_WIDTH - 1);
 
        sendCommand(PAGEADDR);
        sendCommand(0x0);
-       sendCommand(0x7);
+       sendCommand(DISPLAY_HEIGHT / 8 - 1);
 
        uint8_t sendBuffer[17];
        sendBuffer[0] = 0x40;
@@ -31,6 +31,15 @@
 #include "OLEDDisplay.h"
 #include <Wire.h>
 
+#if SSD1306_COLUMN_OFFSET < 0
+#error "The SSD1306 has 128 columns"
+#endif
+
+// Starting a new run of data costs six commands (address, 0x80, command)
+// plus the address and 0x40 of a new data transmission: 20 bytes. Changed
+// runs that are at most this many columns apart are sent as one.
+#define SSD1306_SPAN_MERGE_GAP 20
+
 class SSD1306Wire : public OLEDDisplay {
   private:
       uint8_t             _address;
@@ -42,6 +51,9 @@ class SSD1306Wire : public OLEDDisplay {
       this->_address = _address;
       this->_sda = _sda;
       this->_scl = _scl;
+      #ifdef OLEDDISPLAY_DIFF
+      this->spanMergeGap = SSD1306_SPAN_MERGE_GAP;
+      #endif
     }
 
     bool connect() {
@@ -53,72 +65,25 @@ class SSD1306Wire : public OLEDDisplay {
     }
 
     void display(void) {
-      #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundY = ~0;
-        uint8_t maxBoundY = 0;
-
-        uint8_t minBoundX = ~0;
-        uint8_t maxBoundX = 0;
-        uint8_t x, y;
-
-        // Calculate the Y bounding box of changes
-        // and copy buffer[pos] to buffer_back[pos];
-        for (y = 0; y < (DISPLAY_HEIGHT / 8); y++) {
-          for (x = 0; x < DISPLAY_WIDTH; x++) {
-           uint16_t pos = x + y * DISPLAY_WIDTH;
-           if (buffer[pos] != buffer_back[pos]) {
-             minBoundY = _min(minBoundY, y);
-             maxBoundY = _max(maxBoundY, y);
-             minBoundX = _min(minBoundX, x);
-             maxBoundX = _max(maxBoundX, x);
-           }
-           buffer_back[pos] = buffer[pos];
-         }
-         yield();
-        }
-
-        // If the minBoundY wasn't updated
-        // we can savely assume that buffer_back[pos] == buffer[pos]
-        // holdes true for all values of pos
-        if (minBoundY == ~0) return;
-
-        sendCommand(COLUMNADDR);
-        sendCommand(minBoundX);
-        sendCommand(maxBoundX);
-
-        sendCommand(PAGEADDR);
-        sendCommand(minBoundY);
-        sendCommand(maxBoundY);
-
-        byte k = 0;
-        for (y = minBoundY; y <= maxBoundY; y++) {
-          for (x = minBoundX; x <= maxBoundX; x++) {
-            if (k == 0) {
-              Wire.beginTransmission(_address);
-              Wire.write(0x40);
-            }
-            Wire.write(buffer[x + y * DISPLAY_WIDTH]);
-            k++;
-            if (k == 16)  {
-              Wire.endTransmission();
-              k = 0;
-            }
-          }
-          yield();
-        }
-
-        if (k != 0) {
-          Wire.endTransmission();
-        }
+      #ifdef OLEDDISPLAY_BANDED
+        sendBand();
+      #elif defined(OLEDDISPLAY_DOUBLE_BUFFER)
+        // Send each run of changed columns with its own address window,
+        // unless the gap to the next run is cheaper to resend
+        takeSnapshot();
+        sendPendingPages(DISPLAY_HEIGHT / 8, 0);
+      #elif defined(OLEDDISPLAY_HASH_DIFF)
+        sendChangedSpans();
       #else
+        this->frameBytes = 0;
 
         sendCommand(COLUMNADDR);
-        sendCommand(0x0);
-        sendCommand(0x7F);
+        sendCommand(SSD1306_COLUMN_OFFSET);
+        sendCommand(SSD1306_COLUMN_OFFSET + DISPLAY_WIDTH - 1);
 
         sendCommand(PAGEADDR);
         sendCommand(0x0);
-        sendCommand(0x7);
+        sendCommand(DISPLAY_HEIGHT / 8 - 1);
 
         for (uint16_t i=0; i < DISPLAY_BUFFER_SIZE; i++) {
           Wire.beginTransmission(this->_address);
@@ -129,16 +94,43 @@ class SSD1306Wire : public OLEDDisplay {
           }
           i--;
           Wire.endTransmission();
+          this->frameBytes += 18;
         }
       #endif
     }
 
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    void displayAsync(void) {
+      takeSnapshot();
+    }
+    #endif
+
   private:
+    void sendData(uint8_t page, uint8_t column, const uint8_t *data, uint8_t length) {
+      sendCommand(COLUMNADDR);
+      sendCommand(SSD1306_COLUMN_OFFSET + column);
+      sendCommand(SSD1306_COLUMN_OFFSET + column + length - 1);
+
+      sendCommand(PAGEADDR);
+      sendCommand(page);
+      sendCommand(page);
+
+      for (uint8_t i = 0; i < length; i += 16) {
+        uint8_t chunk = _min(length - i, 16);
+        Wire.beginTransmission(_address);
+        Wire.write(0x40);
+        Wire.write(data + i, chunk);
+        Wire.endTransmission();
+        this->frameBytes += chunk + 2;
+      }
+    }
+
     inline void sendCommand(uint8_t command) __attribute__((always_inline)){
       Wire.beginTransmission(_address);
       Wire.write(0x80);
       Wire.write(command);
       Wire.endTransmission();
+      this->frameBytes += 3;
     }
 
 
@@ -0,0 +1,173 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+ // Compares the page aware span fill of `fillRect` with the old way of
+ // filling a rectangle: one vertical line per column, each clipped and
+ // walked page by page on its own. `drawVerticalLine` now uses the span
+ // fill itself, so the old line code is kept below as
+ // `drawVerticalLinePerColumn`.
+ // The results are printed to the serial console.
+
+ #include <Wire.h>  // Only needed for Arduino 1.6.5 and earlier
+ #include "SSD1306.h" // alias for `#include "SSD1306Wire.h"`
+
+ // Initialize the OLED display using Wire library
+ SSD1306  display(0x3c, D3, D5);
+
+#define ITERATIONS 1000
+
+struct BenchmarkRect {
+  const char *name;
+  int16_t x, y, width, height;
+};
+
+// Sizes taken from the smart clock UI
+BenchmarkRect rects[] = {
+  {"alarm highlight", 30, 20,  30, 22},
+  {"alarm badge",     93, 56,  35, 15},
+  {"progress bar",    8,  30, 108,  7},
+  {"full screen",     0,  0,  128, 64}
+};
+
+// The `drawVerticalLine` of the library before the span fill: it clips
+// and finds the page of every column again and switches on the color
+// for every byte it writes
+void drawVerticalLinePerColumn(int16_t x, int16_t y, int16_t length, OLEDDISPLAY_COLOR color) {
+  if (x < 0 || x >= DISPLAY_WIDTH) return;
+
+  if (y < 0) {
+    length += y;
+    y = 0;
+  }
+
+  if ( (y + length) > DISPLAY_HEIGHT) {
+    length = (DISPLAY_HEIGHT - y);
+  }
+
+  if (length <= 0) return;
+
+
+  uint8_t yOffset = y & 7;
+  uint8_t drawBit;
+  uint8_t *bufferPtr = display.buffer;
+
+  bufferPtr += (y >> 3) * DISPLAY_WIDTH;
+  bufferPtr += x;
+
+  if (yOffset) {
+    yOffset = 8 - yOffset;
+    drawBit = ~(0xFF >> (yOffset));
+
+    if (length < yOffset) {
+      drawBit &= (0xFF >> (yOffset - length));
+    }
+
+    switch (color) {
+      case WHITE:   *bufferPtr |=  drawBit; break;
+      case BLACK:   *bufferPtr &= ~drawBit; break;
+      case INVERSE: *bufferPtr ^=  drawBit; break;
+    }
+
+    if (length < yOffset) return;
+
+    length -= yOffset;
+    bufferPtr += DISPLAY_WIDTH;
+  }
+
+  if (length >= 8) {
+    switch (color) {
+      case WHITE:
+      case BLACK:
+        drawBit = (color == WHITE) ? 0xFF : 0x00;
+        do {
+          *bufferPtr = drawBit;
+          bufferPtr += DISPLAY_WIDTH;
+          length -= 8;
+        } while (length >= 8);
+        break;
+      case INVERSE:
+        do {
+          *bufferPtr = ~(*bufferPtr);
+          bufferPtr += DISPLAY_WIDTH;
+          length -= 8;
+        } while (length >= 8);
+        break;
+    }
+  }
+
+  if (length > 0) {
+    drawBit = (1 << (length & 7)) - 1;
+    switch (color) {
+      case WHITE:   *bufferPtr |=  drawBit; break;
+      case BLACK:   *bufferPtr &= ~drawBit; break;
+      case INVERSE: *bufferPtr ^=  drawBit; break;
+    }
+  }
+}
+
+void fillRectPerColumn(int16_t xMove, int16_t yMove, int16_t width, int16_t height, OLEDDISPLAY_COLOR color) {
+  for (int16_t x = xMove; x < xMove + width; x++) {
+    drawVerticalLinePerColumn(x, yMove, height, color);
+  }
+}
+
+void runBenchmark(BenchmarkRect &rect, OLEDDISPLAY_COLOR color) {
+  display.setColor(color);
+
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < ITERATIONS; i++) {
+    fillRectPerColumn(rect.x, rect.y, rect.width, rect.height, color);
+  }
+  uint32_t perColumn = micros() - start;
+
+  start = micros();
+  for (uint16_t i = 0; i < ITERATIONS; i++) {
+    display.fillRect(rect.x, rect.y, rect.width, rect.height);
+  }
+  uint32_t spanFill = micros() - start;
+
+  Serial.printf("%-16s color %d: old per column lines %6u us, span fill %6u us, span fill is %u.%02ux faster\n",
+    rect.name, color, perColumn, spanFill,
+    perColumn / spanFill, (perColumn * 100 / spanFill) % 100);
+  yield();
+}
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println();
+
+  display.init();
+
+  for (uint8_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+    runBenchmark(rects[i], WHITE);
+    runBenchmark(rects[i], BLACK);
+    runBenchmark(rects[i], INVERSE);
+  }
+
+  display.display();
+}
+
+void loop() { }
@@ -0,0 +1,317 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host tool that converts a BDF font into the JUMPTABLE format of
+// OLEDDisplay.h, or cuts down a font in that format to the characters
+// that are actually drawn.
+//
+//   g++ -O2 -o fontconv fontconv.cpp
+//   fontconv [-n name] [-c chars] [-r first-last] [-p] font.bdf > font.h
+//   fontconv [-n name] [-c chars] [-r first-last] [-p] -a array fonts.h > font.h
+//
+// -n  name of the array, defaults to the name of the array or BDF file
+// -c  keep the characters of this UTF-8 string (Latin-1 only, like drawString())
+// -r  keep the character codes first to last, e.g. -r 48-58
+// -a  read the font array `array` from a header
+// -p  pack the glyphs with PackBits, see fontpack.cpp
+//
+// -c and -r can be repeated, without them all characters from 32 to 255
+// are kept. Characters that are left out have neither a glyph nor a width.
+// The flash saved compared to the whole font is reported on stderr.
+//
+// TrueType fonts have to be rendered into a BDF first, e.g. with
+//   otf2bdf -p 24 -r 72 font.ttf > font.bdf
+// The font is FONT_ASCENT + FONT_DESCENT pixels high and the baseline is
+// FONT_ASCENT rows below the top. Pixels outside of a glyph's advance
+// width or the font height are clipped.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "fontfile.h"
+
+struct BdfGlyph {
+  int code;
+  int width;
+  int bbxWidth;
+  int bbxHeight;
+  int bbxX;
+  int bbxY;
+  std::vector<std::string> rows;
+};
+
+static std::string nameOf(const char *path) {
+  const char *base = strrchr(path, '/');
+  std::string name = base ? base + 1 : path;
+  name = name.substr(0, name.find('.'));
+  for (size_t i = 0; i < name.size(); i++) {
+    if (!isalnum((unsigned char) name[i])) name[i] = '_';
+  }
+  if (name.empty() || isdigit((unsigned char) name[0])) name = "_" + name;
+  return name;
+}
+
+// Draws the bitmap of a BDF glyph into its columns, false if pixels had
+// to be clipped
+static bool placeGlyph(const BdfGlyph &bdf, int ascent, int height, FontGlyph &glyph) {
+  int rasterHeight = (height + 7) / 8;
+  bool clipped = false;
+  glyph.present = true;
+  glyph.width   = bdf.width;
+  glyph.columns.assign(bdf.width * rasterHeight, 0);
+
+  for (int row = 0; row < bdf.bbxHeight && row < (int) bdf.rows.size(); row++) {
+    int y = ascent - (bdf.bbxY + bdf.bbxHeight) + row;
+    for (int column = 0; column < bdf.bbxWidth; column++) {
+      int nibble = column / 4;
+      if (nibble >= (int) bdf.rows[row].size()) break;
+      int bits = strtol(bdf.rows[row].substr(nibble, 1).c_str(), NULL, 16);
+      if (!((bits >> (3 - column % 4)) & 1)) continue;
+
+      int x = bdf.bbxX + column;
+      if (x < 0 || x >= bdf.width || y < 0 || y >= height) {
+        clipped = true;
+        continue;
+      }
+      glyph.columns[x * rasterHeight + y / 8] |= 1 << (y & 7);
+    }
+  }
+  return !clipped;
+}
+
+static bool readBdf(const std::string &text, Font &font, std::string &error) {
+  int ascent  = -1;
+  int descent = -1;
+  int boxHeight = 0;
+  int boxY      = 0;
+  std::vector<BdfGlyph> glyphs;
+  BdfGlyph glyph;
+  bool inChar   = false;
+  bool inBitmap = false;
+
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t end = text.find('\n', pos);
+    if (end == std::string::npos) end = text.size();
+    std::string line = text.substr(pos, end - pos);
+    pos = end + 1;
+    if (!line.empty() && line[line.size() - 1] == '\r') line.erase(line.size() - 1);
+
+    const char *p = line.c_str();
+    int a, b, c, d;
+    if (inBitmap) {
+      if (line == "ENDCHAR") {
+        inBitmap = inChar = false;
+        glyphs.push_back(glyph);
+      } else {
+        glyph.rows.push_back(line);
+      }
+    } else if (sscanf(p, "FONTBOUNDINGBOX %d %d %d %d", &a, &b, &c, &d) == 4) {
+      boxHeight = b;
+      boxY      = d;
+    } else if (sscanf(p, "FONT_ASCENT %d", &a) == 1) {
+      ascent = a;
+    } else if (sscanf(p, "FONT_DESCENT %d", &a) == 1) {
+      descent = a;
+    } else if (!strncmp(p, "STARTCHAR", 9)) {
+      glyph = BdfGlyph();
+      glyph.code = -1;
+      inChar = true;
+    } else if (inChar && sscanf(p, "ENCODING %d", &a) == 1) {
+      glyph.code = a;
+    } else if (inChar && sscanf(p, "DWIDTH %d", &a) == 1) {
+      glyph.width = a;
+    } else if (inChar && sscanf(p, "BBX %d %d %d %d", &a, &b, &c, &d) == 4) {
+      glyph.bbxWidth  = a;
+      glyph.bbxHeight = b;
+      glyph.bbxX      = c;
+      glyph.bbxY      = d;
+    } else if (inChar && line == "BITMAP") {
+      inBitmap = true;
+    }
+  }
+
+  // Without the properties the bounding box of the font decides
+  if (ascent < 0 || descent < 0) {
+    ascent  = boxHeight + boxY;
+    descent = -boxY;
+  }
+  font.height = ascent + descent;
+  if (glyphs.empty() || font.height <= 0 || font.height > 127) {
+    error = glyphs.empty() ? "has no glyphs" : "is not 1 to 127 pixels high";
+    return false;
+  }
+
+  for (int code = 0; code < 256; code++) {
+    font.glyphs[code].present = false;
+    font.glyphs[code].width   = 0;
+    font.glyphs[code].columns.clear();
+  }
+  int clipped = 0;
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    if (glyphs[i].code < 0 || glyphs[i].code > 255 || glyphs[i].width <= 0) continue;
+    if (!placeGlyph(glyphs[i], ascent, font.height, font.glyphs[glyphs[i].code])) clipped++;
+  }
+  if (clipped) {
+    fprintf(stderr, "fontconv: %d glyphs are clipped to their advance width and the font height\n", clipped);
+  }
+  return true;
+}
+
+// Marks the characters of an UTF-8 string, false for characters outside
+// of Latin-1
+static bool keepChars(const char *chars, bool *keep) {
+  const unsigned char *p = (const unsigned char *) chars;
+  while (*p) {
+    if (*p < 0x80) {
+      keep[*p++] = true;
+    } else if ((*p == 0xC2 || *p == 0xC3) && (p[1] & 0xC0) == 0x80) {
+      keep[((p[0] & 0x1F) << 6) | (p[1] & 0x3F)] = true;
+      p += 2;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+static std::string describe(const bool *keep) {
+  std::string chars;
+  for (int code = 0; code < 256; code++) {
+    if (!keep[code]) continue;
+    if (code > 32 && code < 127) {
+      chars += (char) code;
+    } else {
+      char escape[8];
+      snprintf(escape, sizeof(escape), "\\x%02X", code);
+      chars += escape;
+    }
+  }
+  return chars;
+}
+
+static int usage() {
+  fprintf(stderr, "usage: fontconv [-n name] [-c chars] [-r first-last] [-p] [-a array] font.bdf|fonts.h\n");
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  const char *name = NULL;
+  const char *arrayName = NULL;
+  const char *path = NULL;
+  bool packed = false;
+  bool select = false;
+  bool keep[256] = {false};
+
+  for (int i = 1; i < argc; i++) {
+    int first, last;
+    if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      name = argv[++i];
+    } else if (!strcmp(argv[i], "-a") && i + 1 < argc) {
+      arrayName = argv[++i];
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      if (!keepChars(argv[++i], keep)) {
+        fprintf(stderr, "fontconv: only Latin-1 characters can be drawn\n");
+        return 1;
+      }
+      select = true;
+    } else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%d-%d", &first, &last) != 2 || first < 0 || last > 255 || first > last) return usage();
+      for (int code = first; code <= last; code++) keep[code] = true;
+      select = true;
+    } else if (!strcmp(argv[i], "-p")) {
+      packed = true;
+    } else if (argv[i][0] != '-' && !path) {
+      path = argv[i];
+    } else {
+      return usage();
+    }
+  }
+  if (!path) return usage();
+  if (!select) {
+    for (int code = 32; code < 256; code++) keep[code] = true;
+  }
+
+  std::string text;
+  if (!readFile(path, text)) {
+    fprintf(stderr, "fontconv: can't read %s\n", path);
+    return 1;
+  }
+
+  // The whole font, as it is in the header or converted without packing
+  Font font;
+  std::string error;
+  std::vector<unsigned char> whole;
+  if (arrayName) {
+    std::vector<FontArray> arrays = readFontArrays(text);
+    size_t i = 0;
+    while (i < arrays.size() && arrays[i].name != arrayName) i++;
+    if (i == arrays.size()) {
+      fprintf(stderr, "fontconv: %s has no array %s\n", path, arrayName);
+      return 1;
+    }
+    whole = arrays[i].bytes;
+    if (!decodeFont(whole, font, error)) {
+      fprintf(stderr, "fontconv: %s %s\n", arrayName, error.c_str());
+      return 1;
+    }
+  } else {
+    if (!readBdf(text, font, error)) {
+      fprintf(stderr, "fontconv: %s %s\n", path, error.c_str());
+      return 1;
+    }
+    Font range = font;
+    for (int code = 0; code < 32; code++) range.glyphs[code].present = false;
+    if (!encodeFont(range, false, whole, error)) whole.clear();
+  }
+  std::string fontName = name ? name : arrayName ? arrayName : nameOf(path);
+
+  int count = 0;
+  for (int code = 0; code < 256; code++) {
+    font.glyphs[code].present = font.glyphs[code].present && keep[code];
+    keep[code] = font.glyphs[code].present;
+    if (keep[code]) count++;
+  }
+
+  std::vector<unsigned char> bytes;
+  if (!encodeFont(font, packed, bytes, error)) {
+    fprintf(stderr, "fontconv: %s %s\n", fontName.c_str(), error.c_str());
+    return 1;
+  }
+
+  printf("// Generated by fontconv from %s%s\n", path, packed ? ", packed" : "");
+  if (select) printf("// Characters: %s\n", describe(keep).c_str());
+  printf("%s\n", writeFont(fontName, bytes).c_str());
+
+  if (whole.empty()) {
+    fprintf(stderr, "fontconv: %s %d glyphs, %u bytes\n", fontName.c_str(), count, (unsigned) bytes.size());
+  } else {
+    fprintf(stderr, "fontconv: %s %d glyphs, %u bytes, %u for the whole font, %ld bytes saved\n", fontName.c_str(), count,
+            (unsigned) bytes.size(), (unsigned) whole.size(), (long) whole.size() - (long) bytes.size());
+  }
+  return 0;
+}
@@ -0,0 +1,264 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Reads and writes fonts in the JUMPTABLE format of OLEDDisplay.h for the
+// host tools: a header of width, height, first char and number of chars,
+// a jump table of 4 bytes per char (offset, size, width) and the glyphs,
+// (height + 7) / 8 bytes per column, cut after the last byte that isn't 0.
+
+#ifndef FONTFILE_h
+#define FONTFILE_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include "packbits.h"
+
+#define JUMPTABLE_START 4
+#define FONT_PACKED     0x80
+
+struct FontGlyph {
+  bool present;
+  int  width;
+  // (height + 7) / 8 bytes per column, column by column
+  std::vector<unsigned char> columns;
+};
+
+// All 256 character codes, `present` marks the ones the font has
+struct Font {
+  int height;
+  FontGlyph glyphs[256];
+};
+
+// A `const char <name>[] PROGMEM = {...};` array of a header
+struct FontArray {
+  std::string name;
+  size_t start;
+  size_t end;
+  std::vector<unsigned char> bytes;
+};
+
+inline bool readFile(const char *path, std::string &text) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  char chunk[4096];
+  size_t read;
+  while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    text.append(chunk, read);
+  }
+  fclose(file);
+  return true;
+}
+
+// The bytes between the braces, comments are skipped
+inline std::vector<unsigned char> readBytes(const char *p, const char *last) {
+  std::vector<unsigned char> bytes;
+  while (p < last) {
+    if (p[0] == '/' && p[1] == '/') {
+      while (p < last && *p != '\n') p++;
+    } else if (p[0] == '/' && p[1] == '*') {
+      const char *close = strstr(p + 2, "*/");
+      p = close && close < last ? close + 2 : last;
+    } else if (isdigit((unsigned char) *p)) {
+      bytes.push_back(strtol(p, (char **) &p, 0));
+    } else {
+      p++;
+    }
+  }
+  return bytes;
+}
+
+inline std::vector<FontArray> readFontArrays(const std::string &text) {
+  std::vector<FontArray> arrays;
+  size_t pos = 0;
+  size_t start;
+  while ((start = text.find("const char ", pos)) != std::string::npos) {
+    size_t open    = text.find('{', start);
+    size_t close   = text.find("};", open);
+    size_t bracket = text.find("[]", start);
+    if (open == std::string::npos || close == std::string::npos || bracket == std::string::npos || bracket > open) break;
+
+    FontArray array;
+    array.name  = text.substr(start + 11, bracket - start - 11);
+    array.start = start;
+    array.end   = close + 2;
+    array.bytes = readBytes(text.c_str() + open + 1, text.c_str() + close);
+    arrays.push_back(array);
+    pos = array.end;
+  }
+  return arrays;
+}
+
+// Decodes a font, packed or not. Returns false (and why) if it is broken.
+inline bool decodeFont(const std::vector<unsigned char> &bytes, Font &font, std::string &error) {
+  if (bytes.size() < JUMPTABLE_START) {
+    error = "is no font";
+    return false;
+  }
+  bool packed      = bytes[1] & FONT_PACKED;
+  font.height      = bytes[1] & ~FONT_PACKED;
+  int firstChar    = bytes[2];
+  int charCount    = bytes[3];
+  int rasterHeight = (font.height + 7) / 8;
+  size_t dataStart = JUMPTABLE_START + charCount * 4;
+  if (bytes.size() < dataStart || firstChar + charCount > 256) {
+    error = "has a broken jump table";
+    return false;
+  }
+
+  for (int code = 0; code < 256; code++) {
+    font.glyphs[code].present = false;
+    font.glyphs[code].width   = 0;
+    font.glyphs[code].columns.clear();
+  }
+  for (int i = 0; i < charCount; i++) {
+    const unsigned char *jump = &bytes[JUMPTABLE_START + i * 4];
+    FontGlyph &glyph = font.glyphs[firstChar + i];
+    bool noGlyph = jump[0] == 0xFF && jump[1] == 0xFF;
+    size_t length = jump[3] * rasterHeight;
+
+    // Chars without glyph and width aren't part of the font
+    glyph.present = !noGlyph || jump[3] > 0;
+    glyph.width   = jump[3];
+    glyph.columns.assign(length, 0);
+    if (noGlyph) continue;
+
+    size_t offset = dataStart + (jump[0] << 8) + jump[1];
+    size_t size   = jump[2];
+    if (offset + size > bytes.size()) {
+      error = "has a truncated glyph";
+      return false;
+    }
+    if (packed) {
+      glyph.columns = pagesToColumns(unpackBits(&bytes[offset], size, length), glyph.width, rasterHeight);
+    } else {
+      memcpy(&glyph.columns[0], &bytes[offset], size < length ? size : length);
+    }
+  }
+  return true;
+}
+
+// Encodes the glyphs that are present, from the first to the last one.
+// Packed glyphs are stored page by page and compressed with PackBits.
+inline bool encodeFont(const Font &font, bool packed, std::vector<unsigned char> &bytes, std::string &error) {
+  int firstChar = -1;
+  int lastChar  = -1;
+  int maxWidth  = 0;
+  for (int code = 0; code < 256; code++) {
+    if (!font.glyphs[code].present) continue;
+    if (firstChar < 0) firstChar = code;
+    lastChar = code;
+    if (font.glyphs[code].width > maxWidth) maxWidth = font.glyphs[code].width;
+  }
+  if (firstChar < 0 || lastChar - firstChar >= 255 || font.height > 127 || maxWidth > 255) {
+    error = firstChar < 0 ? "has no glyphs" : "doesn't fit into the font header";
+    return false;
+  }
+
+  int rasterHeight = (font.height + 7) / 8;
+  std::vector<unsigned char> jumpTable;
+  std::vector<unsigned char> data;
+  for (int code = firstChar; code <= lastChar; code++) {
+    const FontGlyph &glyph = font.glyphs[code];
+    std::vector<unsigned char> stored = glyph.columns;
+    stored.resize(glyph.present ? glyph.width * rasterHeight : 0, 0);
+    if (packed) stored = columnsToPages(stored, glyph.width, rasterHeight);
+    // The bytes after the end of a glyph are 0
+    while (!stored.empty() && stored.back() == 0) stored.pop_back();
+    if (packed && !stored.empty()) stored = packBits(stored);
+
+    if (stored.empty()) {
+      unsigned char entry[] = {0xFF, 0xFF, 0x00, (unsigned char) (glyph.present ? glyph.width : 0)};
+      jumpTable.insert(jumpTable.end(), entry, entry + 4);
+      continue;
+    }
+    if (stored.size() > 255 || data.size() + stored.size() > 0xFFFE) {
+      char message[64];
+      snprintf(message, sizeof(message), "has a glyph (%d) that doesn't fit into the jump table", code);
+      error = message;
+      return false;
+    }
+    unsigned char entry[] = {(unsigned char) (data.size() >> 8), (unsigned char) (data.size() & 0xFF),
+                             (unsigned char) stored.size(), (unsigned char) glyph.width};
+    jumpTable.insert(jumpTable.end(), entry, entry + 4);
+    data.insert(data.end(), stored.begin(), stored.end());
+  }
+
+  unsigned char header[] = {(unsigned char) maxWidth, (unsigned char) (font.height | (packed ? FONT_PACKED : 0)),
+                            (unsigned char) firstChar, (unsigned char) (lastChar - firstChar + 1)};
+  bytes.assign(header, header + JUMPTABLE_START);
+  bytes.insert(bytes.end(), jumpTable.begin(), jumpTable.end());
+  bytes.insert(bytes.end(), data.begin(), data.end());
+  return true;
+}
+
+// The array in the layout of the fonts in OLEDDisplayFonts.h
+inline std::string writeFont(const std::string &name, const std::vector<unsigned char> &font) {
+  int firstChar    = font[2];
+  int charCount    = font[3];
+  size_t dataStart = JUMPTABLE_START + charCount * 4;
+  char line[128];
+  std::string out;
+
+  snprintf(line, sizeof(line), "const char %s[] PROGMEM = {\n", name.c_str());
+  out += line;
+  snprintf(line, sizeof(line), "  0x%02X, // Width: %d\n", font[0], font[0]);
+  out += line;
+  snprintf(line, sizeof(line), "  0x%02X, // Height: %d%s\n", font[1], font[1] & ~FONT_PACKED, font[1] & FONT_PACKED ? ", packed" : "");
+  out += line;
+  snprintf(line, sizeof(line), "  0x%02X, // First Char: %d\n", firstChar, firstChar);
+  out += line;
+  snprintf(line, sizeof(line), "  0x%02X, // Numbers of Chars: %d\n\n  // Jump Table:\n", charCount, charCount);
+  out += line;
+  for (int i = 0; i < charCount; i++) {
+    const unsigned char *jump = &font[JUMPTABLE_START + i * 4];
+    snprintf(line, sizeof(line), "  0x%02X, 0x%02X, 0x%02X, 0x%02X,  // %d:%d\n", jump[0], jump[1], jump[2], jump[3],
+             firstChar + i, (jump[0] << 8) + jump[1]);
+    out += line;
+  }
+  out += "\n  // Font Data:\n";
+  for (int i = 0; i < charCount; i++) {
+    const unsigned char *jump = &font[JUMPTABLE_START + i * 4];
+    if (jump[0] == 0xFF && jump[1] == 0xFF) continue;
+    size_t offset = dataStart + (jump[0] << 8) + jump[1];
+    out += "  ";
+    for (size_t j = offset; j < offset + jump[2]; j++) {
+      snprintf(line, sizeof(line), "0x%02X,", font[j]);
+      out += line;
+    }
+    snprintf(line, sizeof(line), " // %d\n", firstChar + i);
+    out += line;
+  }
+  // No trailing comma after the last byte
+  size_t comma = out.rfind(',');
+  out.erase(comma, 1);
+  out += "};";
+  return out;
+}
+
+#endif
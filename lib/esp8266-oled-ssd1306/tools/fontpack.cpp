@@ -0,0 +1,88 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host tool that compresses the glyphs of fonts in the JUMPTABLE format
+// (the format of OLEDDisplayFonts.h). Each glyph is stored page by page
+// and packed with PackBits, bit 7 of the height marks the font as packed.
+// OLEDDisplay decodes the glyphs while it draws them.
+//
+//   g++ -O2 -o fontpack fontpack.cpp
+//   fontpack fonts.h > fonts_packed.h
+//
+// Every `const char <name>[] PROGMEM = {...};` array in the file is
+// replaced, everything else is copied. Fonts that would not get smaller
+// are kept as they are. The bytes saved are reported on stderr.
+
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "fontfile.h"
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: fontpack fonts.h\n");
+    return 1;
+  }
+  std::string text;
+  if (!readFile(argv[1], text)) {
+    fprintf(stderr, "fontpack: can't read %s\n", argv[1]);
+    return 1;
+  }
+
+  std::vector<FontArray> arrays = readFontArrays(text);
+  std::string out;
+  long saved = 0;
+  size_t pos = 0;
+  for (size_t i = 0; i < arrays.size(); i++) {
+    const FontArray &array = arrays[i];
+    const char *name = array.name.c_str();
+    out += text.substr(pos, array.start - pos);
+    pos = array.end;
+
+    Font font;
+    std::vector<unsigned char> packed;
+    std::string error;
+    if (array.bytes.size() > 1 && (array.bytes[1] & FONT_PACKED)) {
+      fprintf(stderr, "fontpack: %s is packed already\n", name);
+    } else if (!decodeFont(array.bytes, font, error) || !encodeFont(font, true, packed, error)) {
+      fprintf(stderr, "fontpack: %s %s\n", name, error.c_str());
+    } else if (packed.size() >= array.bytes.size()) {
+      fprintf(stderr, "fontpack: %s doesn't get smaller, %u bytes packed\n", name, (unsigned) packed.size());
+    } else {
+      fprintf(stderr, "fontpack: %s %u -> %u bytes, %u bytes saved\n", name,
+              (unsigned) array.bytes.size(), (unsigned) packed.size(), (unsigned) (array.bytes.size() - packed.size()));
+      saved += array.bytes.size() - packed.size();
+      out += writeFont(array.name, packed);
+      continue;
+    }
+    out += text.substr(array.start, array.end - array.start);
+  }
+  out += text.substr(pos);
+
+  fwrite(out.data(), 1, out.size(), stdout);
+  fprintf(stderr, "fontpack: %ld bytes of flash saved\n", saved);
+  return 0;
+}
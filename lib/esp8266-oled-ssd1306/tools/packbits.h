@@ -0,0 +1,110 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// PackBits encoder shared by the host tools. A header n < 128 is followed
+// by n + 1 literal bytes, n >= 128 repeats the next byte 257 - n times,
+// which is what the PackBitsReader in OLEDDisplay.cpp decodes.
+
+#ifndef PACKBITS_h
+#define PACKBITS_h
+
+#include <stddef.h>
+#include <vector>
+
+inline std::vector<unsigned char> packBits(const std::vector<unsigned char> &data) {
+  std::vector<unsigned char> packed;
+  size_t literalStart = 0;
+  size_t i = 0;
+
+  while (i <= data.size()) {
+    size_t run = 1;
+    while (i + run < data.size() && run < 128 && data[i + run] == data[i]) run++;
+
+    // A run of two only pays off if no literal is pending
+    bool repeat = i < data.size() && (run >= 3 || (run == 2 && literalStart == i));
+    if (i == data.size() || repeat || i - literalStart == 128) {
+      while (literalStart < i) {
+        size_t count = i - literalStart < 128 ? i - literalStart : 128;
+        packed.push_back(count - 1);
+        packed.insert(packed.end(), data.begin() + literalStart, data.begin() + literalStart + count);
+        literalStart += count;
+      }
+      if (i == data.size()) break;
+    }
+    if (repeat) {
+      packed.push_back(257 - run);
+      packed.push_back(data[i]);
+      i += run;
+      literalStart = i;
+    } else {
+      i++;
+    }
+  }
+  return packed;
+}
+
+// Decodes `size` bytes of PackBits into `length` bytes, the bytes after
+// the end of the stream are 0
+inline std::vector<unsigned char> unpackBits(const unsigned char *data, size_t size, size_t length) {
+  std::vector<unsigned char> unpacked;
+  size_t i = 0;
+  while (i < size && unpacked.size() < length) {
+    unsigned char header = data[i++];
+    if (header >= 128) {
+      unpacked.insert(unpacked.end(), 257 - header, i < size ? data[i] : 0);
+      i++;
+    } else {
+      for (int n = 0; n <= header && i < size; n++) unpacked.push_back(data[i++]);
+    }
+  }
+  unpacked.resize(length, 0);
+  return unpacked;
+}
+
+// Glyphs are stored column by column, packed glyphs and sprites page by
+// page, so the runs follow the rows
+inline std::vector<unsigned char> columnsToPages(const std::vector<unsigned char> &columns, int width, int rasterHeight) {
+  std::vector<unsigned char> pages(width * rasterHeight, 0);
+  for (int column = 0; column < width; column++) {
+    for (int page = 0; page < rasterHeight; page++) {
+      size_t pos = column * rasterHeight + page;
+      if (pos < columns.size()) pages[page * width + column] = columns[pos];
+    }
+  }
+  return pages;
+}
+
+inline std::vector<unsigned char> pagesToColumns(const std::vector<unsigned char> &pages, int width, int rasterHeight) {
+  std::vector<unsigned char> columns(width * rasterHeight, 0);
+  for (int column = 0; column < width; column++) {
+    for (int page = 0; page < rasterHeight; page++) {
+      size_t pos = page * width + column;
+      if (pos < pages.size()) columns[column * rasterHeight + page] = pages[pos];
+    }
+  }
+  return columns;
+}
+
+#endif
@@ -0,0 +1,219 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host tool that converts a XBM into the page layout used by
+// OLEDDisplay::drawSprite(), (height + 7) / 8 pages of `width` bytes.
+//
+//   g++ -O2 -o xbm2sprite xbm2sprite.cpp
+//   xbm2sprite [-n name] [-i] [-m mask.xbm | -o | -p] image.xbm > image.h
+//
+// -n  name of the arrays, defaults to the name in the XBM
+// -i  invert the image
+// -m  write a mask from a second XBM of the same size, set bits are opaque
+// -o  write a mask that makes the whole rectangle opaque
+// -p  pack the sprite with PackBits, draw it with drawPackedSprite()
+//
+// Besides plain XBM files the C arrays of images.h files are accepted, the
+// bytes may be written in hex, decimal or as Arduino B01010101 constants.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include "packbits.h"
+
+struct Xbm {
+  std::string name;
+  int width;
+  int height;
+  std::vector<unsigned char> bits;
+
+  bool pixel(int x, int y) const {
+    return (bits[y * ((width + 7) / 8) + x / 8] >> (x & 7)) & 1;
+  }
+};
+
+static bool readFile(const char *path, std::string &text) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  char chunk[4096];
+  size_t read;
+  while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    text.append(chunk, read);
+  }
+  fclose(file);
+  return true;
+}
+
+// Value of `#define <name>_<suffix> <value>`, -1 if there is none
+static int readDefine(const std::string &text, const char *suffix, std::string &name) {
+  size_t pos = 0;
+  while ((pos = text.find("#define", pos)) != std::string::npos) {
+    char define[256];
+    int value;
+    if (sscanf(text.c_str() + pos, "#define %255s %d", define, &value) == 2) {
+      std::string symbol = define;
+      std::string tail = std::string("_") + suffix;
+      if (symbol.size() > tail.size() && symbol.compare(symbol.size() - tail.size(), tail.size(), tail) == 0) {
+        name = symbol.substr(0, symbol.size() - tail.size());
+        return value;
+      }
+    }
+    pos += 7;
+  }
+  return -1;
+}
+
+static bool readXbm(const char *path, Xbm &xbm) {
+  std::string text;
+  if (!readFile(path, text)) {
+    fprintf(stderr, "xbm2sprite: can't read %s\n", path);
+    return false;
+  }
+
+  xbm.width  = readDefine(text, "width", xbm.name);
+  xbm.height = readDefine(text, "height", xbm.name);
+  size_t start = text.find('{');
+  size_t end   = text.find('}', start);
+  if (xbm.width <= 0 || xbm.height <= 0 || start == std::string::npos || end == std::string::npos) {
+    fprintf(stderr, "xbm2sprite: %s has no _width, _height or data\n", path);
+    return false;
+  }
+
+  const char *p = text.c_str() + start + 1;
+  const char *last = text.c_str() + end;
+  while (p < last) {
+    if (p[0] == 'B' && (p[1] == '0' || p[1] == '1')) {
+      xbm.bits.push_back(strtol(p + 1, (char **) &p, 2));
+    } else if (isdigit((unsigned char) *p)) {
+      xbm.bits.push_back(strtol(p, (char **) &p, 0));
+    } else {
+      p++;
+    }
+  }
+
+  size_t size = (xbm.width + 7) / 8 * xbm.height;
+  if (xbm.bits.size() < size) {
+    fprintf(stderr, "xbm2sprite: %s has %u bytes, %u expected\n", path, (unsigned) xbm.bits.size(), (unsigned) size);
+    return false;
+  }
+  return true;
+}
+
+static void writeArray(const std::string &name, const char *suffix, const std::vector<unsigned char> &data) {
+  printf("const uint8_t %s_%s[] PROGMEM = {\n", name.c_str(), suffix);
+  for (size_t i = 0; i < data.size(); i++) {
+    printf("%s0x%02X,%s", i % 12 == 0 ? "  " : "", data[i], (i + 1) % 12 == 0 || i + 1 == data.size() ? "\n" : " ");
+  }
+  printf("};\n");
+}
+
+// Page layout: bit n of byte `page * width + x` is the row `page * 8 + n`
+static std::vector<unsigned char> toPages(const Xbm &xbm, bool invert) {
+  int pages = (xbm.height + 7) / 8;
+  std::vector<unsigned char> data(pages * xbm.width, 0);
+  for (int y = 0; y < xbm.height; y++) {
+    for (int x = 0; x < xbm.width; x++) {
+      if (xbm.pixel(x, y) != invert) {
+        data[(y / 8) * xbm.width + x] |= 1 << (y & 7);
+      }
+    }
+  }
+  return data;
+}
+
+static int usage() {
+  fprintf(stderr, "usage: xbm2sprite [-n name] [-i] [-m mask.xbm | -o | -p] image.xbm\n");
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  const char *name = NULL;
+  const char *maskPath = NULL;
+  const char *imagePath = NULL;
+  bool invert = false;
+  bool opaque = false;
+  bool packed = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      name = argv[++i];
+    } else if (!strcmp(argv[i], "-m") && i + 1 < argc) {
+      maskPath = argv[++i];
+    } else if (!strcmp(argv[i], "-i")) {
+      invert = true;
+    } else if (!strcmp(argv[i], "-o")) {
+      opaque = true;
+    } else if (!strcmp(argv[i], "-p")) {
+      packed = true;
+    } else if (argv[i][0] != '-' && !imagePath) {
+      imagePath = argv[i];
+    } else {
+      return usage();
+    }
+  }
+  if (!imagePath || (maskPath && opaque) || (packed && (maskPath || opaque))) return usage();
+
+  Xbm image;
+  if (!readXbm(imagePath, image)) return 1;
+  if (name) image.name = name;
+
+  std::vector<unsigned char> pages = toPages(image, invert);
+  std::vector<unsigned char> mask;
+  if (maskPath) {
+    Xbm maskXbm;
+    if (!readXbm(maskPath, maskXbm)) return 1;
+    if (maskXbm.width != image.width || maskXbm.height != image.height) {
+      fprintf(stderr, "xbm2sprite: the mask is %dx%d, the image %dx%d\n", maskXbm.width, maskXbm.height, image.width, image.height);
+      return 1;
+    }
+    mask = toPages(maskXbm, false);
+  } else if (opaque) {
+    Xbm full = image;
+    full.bits.assign(full.bits.size(), 0xFF);
+    mask = toPages(full, false);
+  }
+
+  if (packed) {
+    std::vector<unsigned char> stream = packBits(pages);
+    fprintf(stderr, "xbm2sprite: %u -> %u bytes\n", (unsigned) pages.size(), (unsigned) stream.size());
+    printf("// Generated by xbm2sprite from %s, draw with drawPackedSprite()\n", imagePath);
+    printf("#define %s_width %d\n", image.name.c_str(), image.width);
+    printf("#define %s_height %d\n", image.name.c_str(), image.height);
+    writeArray(image.name, "packed", stream);
+    return 0;
+  }
+
+  printf("// Generated by xbm2sprite from %s, draw with drawSprite()\n", imagePath);
+  printf("#define %s_width %d\n", image.name.c_str(), image.width);
+  printf("#define %s_height %d\n", image.name.c_str(), image.height);
+  writeArray(image.name, "sprite", pages);
+  if (!mask.empty()) {
+    writeArray(image.name, "mask", mask);
+  }
+  return 0;
+}
@@ -24,7 +24,7 @@ struct AlarmSetting
 {
 public:
     AlarmMode mode = OFF;
-    String getModeString()
+    const char *getModeString()
     {
         switch (mode)
         {
@@ -34,7 +34,18 @@ public:
                 return "On";
             case WEEK_DAYS:
                 return "WEEKDAYS";
+            case WEEK_ENDS:
+                return "WEEKENDS";
         }
+        return "";
+    }
+
+    // Writes a zero padded two digit number into `text` (3 chars)
+    static void formatTwoDigits(int16_t value, char *text)
+    {
+        text[0] = '0' + value / 10;
+        text[1] = '0' + value % 10;
+        text[2] = 0;
     }
 
     int16_t hours = 0;
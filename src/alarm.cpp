@@ -93,6 +93,7 @@ void Alarm::draw(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int
     display->setFont(ArialMT_Plain_24);
     if (this->settingStage == SET_HOUR || this->settingStage == SET_MIN)
     {
+        char digits[3];
         display->drawString(64 + x, 17 + y, ":");
         display->setTextAlignment(TEXT_ALIGN_LEFT);
         if (this->settingStage == SET_HOUR)
@@ -105,7 +106,8 @@ void Alarm::draw(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int
         {
             display->setColor(WHITE);
         }
-        display->drawString(32 + x, 17 + y, this->settings.getFormatedHours());
+        AlarmSetting::formatTwoDigits(this->settings.hours, digits);
+        display->drawString(32 + x, 17 + y, digits);
 
         if (this->settingStage == SET_MIN)
         {
@@ -117,7 +119,8 @@ void Alarm::draw(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int
         {
             display->setColor(WHITE);
         }
-        display->drawString(70 + x, 17 + y, this->settings.getFormatedMinutes());
+        AlarmSetting::formatTwoDigits(this->settings.minutes, digits);
+        display->drawString(70 + x, 17 + y, digits);
     }
     else if (this->settingStage == SET_MODE)
     {
@@ -141,14 +144,17 @@ void Alarm::beginSetting()
 {
     this->stopBeeps = 0;
     this->settingStage = SET_HOUR;
+    this->version++;
 }
 void Alarm::endSetting()
 {
     this->settingStage = NONE;
+    this->version++;
 }
 
 bool Alarm::nextSettingStage()
 {
+    this->version++;
     if (this->settingStage == SET_MODE)
     {
         this->saveSettings();
@@ -169,6 +175,7 @@ bool Alarm::nextSettingStage()
 
 void Alarm::onMinusButtonClick()
 {
+    this->version++;
     if (this->settingStage == SET_HOUR)
     {
         if (this->settings.hours == 0)
@@ -206,6 +213,7 @@ void Alarm::onMinusButtonClick()
 
 void Alarm::onPlusButtonClick()
 {
+    this->version++;
     if (this->settingStage == SET_HOUR)
     {
         if (this->getSettings().hours == 23)
@@ -252,10 +260,16 @@ AlarmSettingStage Alarm::getSettingStage()
     return this->settingStage;
 }
 
+uint32_t Alarm::getVersion()
+{
+    return this->version;
+}
+
 
 void Alarm::loadSettings()
 {
     Serial.println("Reading Settings...");
+    this->version++;
 
     int mode = EEPROM.read(99);
     if (mode > 3)
@@ -25,6 +25,8 @@ public:
 
     AlarmSetting getSettings();
     AlarmSettingStage getSettingStage();
+    // Changes whenever the settings or the setting stage change
+    uint32_t getVersion();
 
     void onMinusButtonClick();
     void onPlusButtonClick();
@@ -34,6 +36,7 @@ private:
     WundergroundClient *wunderground;
     AlarmSetting settings;
     AlarmSettingStage settingStage = NONE;
+    uint32_t version = 0;
 
     int beeps = 0;
     long stopBeeps = 0;
@@ -0,0 +1,43 @@
+#include "allocation-counter.h"
+
+#ifdef COUNT_ALLOCATIONS
+
+static volatile uint32_t allocationCount = 0;
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__real_calloc(size_t count, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    allocationCount++;
+    return __real_malloc(size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    allocationCount++;
+    return __real_realloc(ptr, size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    allocationCount++;
+    return __real_calloc(count, size);
+}
+}
+
+uint32_t getAllocationCount()
+{
+    return allocationCount;
+}
+
+#else
+
+uint32_t getAllocationCount()
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <Arduino.h>
+
+// Counts heap allocations when the firmware is linked with
+// -Wl,--wrap=malloc -Wl,--wrap=realloc -Wl,--wrap=calloc and built with
+// COUNT_ALLOCATIONS defined (see the d1_mini_alloc_count environment).
+// Without it the counter always reads 0.
+uint32_t getAllocationCount();
+
+#endif
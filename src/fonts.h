@@ -25,854 +25,185 @@ See more at http://blog.squix.ch
 #define FONT_LIB_V3
 // Created by http://oleddisplay.squix.ch/ Consider a donation
 // In case of problems make sure that you are using the font file with the correct version!
+// The Meteocons fonts are cut down to the icons that
+// WundergroundClient::getMeteoconIcon() returns with tools/fontconv.cpp
+// Generated by fontconv from fonts.h, packed
+// Characters: #&)0234579BEFHJMQRSVWY
 const char Meteocons_Plain_42[] PROGMEM = {
   0x2A, // Width: 42
-  0x2C, // Height: 44
-  0x20, // First Char: 32
-  0xE0, // Numbers of Chars: 224
+  0xAC, // Height: 44, packed
+  0x23, // First Char: 35
+  0x37, // Numbers of Chars: 55
 
   // Jump Table:
-  0xFF, 0xFF, 0x00, 0x15,  // 32:65535
-  0x00, 0x00, 0xF3, 0x2A,  // 33:0
-  0x00, 0xF3, 0xF9, 0x2A,  // 34:243
-  0x01, 0xEC, 0xF9, 0x2A,  // 35:492
-  0x02, 0xE5, 0xF9, 0x2A,  // 36:741
-  0x03, 0xDE, 0xFA, 0x2A,  // 37:990
-  0x04, 0xD8, 0xF9, 0x2A,  // 38:1240
-  0x05, 0xD1, 0x9B, 0x2A,  // 39:1489
-  0x06, 0x6C, 0xFA, 0x2A,  // 40:1644
-  0x07, 0x66, 0xE2, 0x2A,  // 41:1894
-  0x08, 0x48, 0xB2, 0x2A,  // 42:2120
-  0x08, 0xFA, 0xB1, 0x2A,  // 43:2298
-  0x09, 0xAB, 0x66, 0x19,  // 44:2475
-  0x0A, 0x11, 0x7C, 0x19,  // 45:2577
-  0x0A, 0x8D, 0x5F, 0x19,  // 46:2701
-  0x0A, 0xEC, 0x8C, 0x19,  // 47:2796
-  0x0B, 0x78, 0xF9, 0x2A,  // 48:2936
-  0x0C, 0x71, 0xE1, 0x2A,  // 49:3185
-  0x0D, 0x52, 0xB2, 0x2A,  // 50:3410
-  0x0E, 0x04, 0xFB, 0x2A,  // 51:3588
-  0x0E, 0xFF, 0xFB, 0x2A,  // 52:3839
-  0x0F, 0xFA, 0xFA, 0x2A,  // 53:4090
-  0x10, 0xF4, 0xF9, 0x2A,  // 54:4340
-  0x11, 0xED, 0xF9, 0x2A,  // 55:4589
-  0x12, 0xE6, 0xF9, 0x2A,  // 56:4838
-  0x13, 0xDF, 0xF4, 0x2A,  // 57:5087
-  0x14, 0xD3, 0x5F, 0x19,  // 58:5331
-  0x15, 0x32, 0x66, 0x19,  // 59:5426
-  0x15, 0x98, 0x95, 0x19,  // 60:5528
-  0x16, 0x2D, 0x89, 0x19,  // 61:5677
-  0x16, 0xB6, 0x94, 0x19,  // 62:5814
-  0x17, 0x4A, 0x7A, 0x19,  // 63:5962
-  0x17, 0xC4, 0x94, 0x19,  // 64:6084
-  0x18, 0x58, 0xC2, 0x2A,  // 65:6232
-  0x19, 0x1A, 0xE1, 0x2A,  // 66:6426
-  0x19, 0xFB, 0xB8, 0x2A,  // 67:6651
-  0x1A, 0xB3, 0xD6, 0x2A,  // 68:6835
-  0x1B, 0x89, 0xF3, 0x2A,  // 69:7049
-  0x1C, 0x7C, 0xE7, 0x2A,  // 70:7292
-  0x1D, 0x63, 0xC4, 0x2A,  // 71:7523
-  0x1E, 0x27, 0xFB, 0x2A,  // 72:7719
-  0x1F, 0x22, 0xFB, 0x2A,  // 73:7970
-  0x20, 0x1D, 0xE3, 0x2A,  // 74:8221
-  0x21, 0x00, 0xE3, 0x2A,  // 75:8448
-  0x21, 0xE3, 0xFB, 0x2A,  // 76:8675
-  0x22, 0xDE, 0xCA, 0x2A,  // 77:8926
-  0x23, 0xA8, 0xFA, 0x2A,  // 78:9128
-  0x24, 0xA2, 0xF9, 0x2A,  // 79:9378
-  0x25, 0x9B, 0xF9, 0x2A,  // 80:9627
-  0x26, 0x94, 0xF9, 0x2A,  // 81:9876
-  0x27, 0x8D, 0xF9, 0x2A,  // 82:10125
-  0x28, 0x86, 0xFA, 0x2A,  // 83:10374
-  0x29, 0x80, 0xF9, 0x2A,  // 84:10624
-  0x2A, 0x79, 0xF9, 0x2A,  // 85:10873
-  0x2B, 0x72, 0xF9, 0x2A,  // 86:11122
-  0x2C, 0x6B, 0xF9, 0x2A,  // 87:11371
-  0x2D, 0x64, 0xF9, 0x2A,  // 88:11620
-  0x2E, 0x5D, 0xFB, 0x2A,  // 89:11869
-  0x2F, 0x58, 0xF9, 0x2A,  // 90:12120
-  0x30, 0x51, 0x8C, 0x19,  // 91:12369
-  0x30, 0xDD, 0x90, 0x19,  // 92:12509
-  0x31, 0x6D, 0x6C, 0x19,  // 93:12653
-  0x31, 0xD9, 0x88, 0x19,  // 94:12761
-  0x32, 0x61, 0x8A, 0x19,  // 95:12897
-  0x32, 0xEB, 0x62, 0x19,  // 96:13035
-  0x33, 0x4D, 0x89, 0x19,  // 97:13133
-  0x33, 0xD6, 0x88, 0x19,  // 98:13270
-  0x34, 0x5E, 0x83, 0x19,  // 99:13406
-  0x34, 0xE1, 0x83, 0x19,  // 100:13537
-  0x35, 0x64, 0x83, 0x19,  // 101:13668
-  0x35, 0xE7, 0x8C, 0x19,  // 102:13799
-  0x36, 0x73, 0x84, 0x19,  // 103:13939
-  0x36, 0xF7, 0x83, 0x19,  // 104:14071
-  0x37, 0x7A, 0x77, 0x19,  // 105:14202
-  0x37, 0xF1, 0x6C, 0x19,  // 106:14321
-  0x38, 0x5D, 0x8F, 0x19,  // 107:14429
-  0x38, 0xEC, 0x71, 0x19,  // 108:14572
-  0x39, 0x5D, 0x89, 0x19,  // 109:14685
-  0x39, 0xE6, 0x83, 0x19,  // 110:14822
-  0x3A, 0x69, 0x88, 0x19,  // 111:14953
-  0x3A, 0xF1, 0x88, 0x19,  // 112:15089
-  0x3B, 0x79, 0x84, 0x19,  // 113:15225
-  0x3B, 0xFD, 0x82, 0x19,  // 114:15357
-  0x3C, 0x7F, 0x83, 0x19,  // 115:15487
-  0x3D, 0x02, 0x89, 0x19,  // 116:15618
-  0x3D, 0x8B, 0x83, 0x19,  // 117:15755
-  0x3E, 0x0E, 0x8D, 0x19,  // 118:15886
-  0x3E, 0x9B, 0x94, 0x19,  // 119:16027
-  0x3F, 0x2F, 0x89, 0x19,  // 120:16175
-  0x3F, 0xB8, 0x8D, 0x19,  // 121:16312
-  0x40, 0x45, 0x83, 0x19,  // 122:16453
-  0x40, 0xC8, 0x86, 0x19,  // 123:16584
-  0x41, 0x4E, 0x54, 0x19,  // 124:16718
-  0x41, 0xA2, 0x76, 0x19,  // 125:16802
-  0x42, 0x18, 0x8E, 0x19,  // 126:16920
-  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 128:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 129:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 130:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 131:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 132:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 133:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 134:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 135:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 136:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 137:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 138:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 139:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 140:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 141:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 142:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 143:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 144:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 145:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 146:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 147:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 148:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 149:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 150:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 151:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 152:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 153:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 154:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 155:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 156:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 157:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 158:65535
-  0xFF, 0xFF, 0x00, 0x2A,  // 159:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 160:65535
-  0x42, 0xA6, 0x60, 0x19,  // 161:17062
-  0x43, 0x06, 0x7D, 0x19,  // 162:17158
-  0x43, 0x83, 0x83, 0x19,  // 163:17283
-  0x44, 0x06, 0x89, 0x19,  // 164:17414
-  0x44, 0x8F, 0x8C, 0x19,  // 165:17551
-  0x45, 0x1B, 0x54, 0x19,  // 166:17691
-  0x45, 0x6F, 0x84, 0x19,  // 167:17775
-  0x45, 0xF3, 0x6E, 0x19,  // 168:17907
-  0x46, 0x61, 0x94, 0x19,  // 169:18017
-  0x46, 0xF5, 0x75, 0x19,  // 170:18165
-  0x47, 0x6A, 0x89, 0x19,  // 171:18282
-  0x47, 0xF3, 0x89, 0x19,  // 172:18419
-  0x48, 0x7C, 0x7C, 0x19,  // 173:18556
-  0x48, 0xF8, 0x94, 0x19,  // 174:18680
-  0x49, 0x8C, 0x68, 0x19,  // 175:18828
-  0x49, 0xF4, 0x68, 0x19,  // 176:18932
-  0x4A, 0x5C, 0x8F, 0x19,  // 177:19036
-  0x4A, 0xEB, 0x76, 0x19,  // 178:19179
-  0x4B, 0x61, 0x8D, 0x19,  // 179:19297
-  0x4B, 0xEE, 0x61, 0x19,  // 180:19438
-  0x4C, 0x4F, 0x7D, 0x19,  // 181:19535
-  0x4C, 0xCC, 0x86, 0x19,  // 182:19660
-  0x4D, 0x52, 0x5E, 0x19,  // 183:19794
-  0x4D, 0xB0, 0x60, 0x19,  // 184:19888
-  0x4E, 0x10, 0x7C, 0x19,  // 185:19984
-  0x4E, 0x8C, 0x7B, 0x19,  // 186:20108
-  0x4F, 0x07, 0x82, 0x19,  // 187:20231
-  0x4F, 0x89, 0x8F, 0x19,  // 188:20361
-  0x50, 0x18, 0x8C, 0x19,  // 189:20504
-  0x50, 0xA4, 0x8F, 0x19,  // 190:20644
-  0x51, 0x33, 0x78, 0x19,  // 191:20787
-  0x51, 0xAB, 0x83, 0x19,  // 192:20907
-  0x52, 0x2E, 0x83, 0x19,  // 193:21038
-  0x52, 0xB1, 0x83, 0x19,  // 194:21169
-  0x53, 0x34, 0x83, 0x19,  // 195:21300
-  0x53, 0xB7, 0x83, 0x19,  // 196:21431
-  0x54, 0x3A, 0x83, 0x19,  // 197:21562
-  0x54, 0xBD, 0x8F, 0x19,  // 198:21693
-  0x55, 0x4C, 0x83, 0x19,  // 199:21836
-  0x55, 0xCF, 0x7D, 0x19,  // 200:21967
-  0x56, 0x4C, 0x7D, 0x19,  // 201:22092
-  0x56, 0xC9, 0x7D, 0x19,  // 202:22217
-  0x57, 0x46, 0x7D, 0x19,  // 203:22342
-  0x57, 0xC3, 0x7D, 0x19,  // 204:22467
-  0x58, 0x40, 0x7D, 0x19,  // 205:22592
-  0x58, 0xBD, 0x7D, 0x19,  // 206:22717
-  0x59, 0x3A, 0x7D, 0x19,  // 207:22842
-  0x59, 0xB7, 0x8E, 0x19,  // 208:22967
-  0x5A, 0x45, 0x83, 0x19,  // 209:23109
-  0x5A, 0xC8, 0x8E, 0x19,  // 210:23240
-  0x5B, 0x56, 0x8E, 0x19,  // 211:23382
-  0x5B, 0xE4, 0x8E, 0x19,  // 212:23524
-  0x5C, 0x72, 0x8E, 0x19,  // 213:23666
-  0x5D, 0x00, 0x8E, 0x19,  // 214:23808
-  0x5D, 0x8E, 0x7D, 0x19,  // 215:23950
-  0x5E, 0x0B, 0x8E, 0x19,  // 216:24075
-  0x5E, 0x99, 0x83, 0x19,  // 217:24217
-  0x5F, 0x1C, 0x83, 0x19,  // 218:24348
-  0x5F, 0x9F, 0x83, 0x19,  // 219:24479
-  0x60, 0x22, 0x83, 0x19,  // 220:24610
-  0x60, 0xA5, 0x86, 0x19,  // 221:24741
-  0x61, 0x2B, 0x88, 0x19,  // 222:24875
-  0x61, 0xB3, 0x89, 0x19,  // 223:25011
-  0x62, 0x3C, 0x89, 0x19,  // 224:25148
-  0x62, 0xC5, 0x89, 0x19,  // 225:25285
-  0x63, 0x4E, 0x89, 0x19,  // 226:25422
-  0x63, 0xD7, 0x89, 0x19,  // 227:25559
-  0x64, 0x60, 0x89, 0x19,  // 228:25696
-  0x64, 0xE9, 0x89, 0x19,  // 229:25833
-  0x65, 0x72, 0x8F, 0x19,  // 230:25970
-  0x66, 0x01, 0x7D, 0x19,  // 231:26113
-  0x66, 0x7E, 0x83, 0x19,  // 232:26238
-  0x67, 0x01, 0x83, 0x19,  // 233:26369
-  0x67, 0x84, 0x83, 0x19,  // 234:26500
-  0x68, 0x07, 0x83, 0x19,  // 235:26631
-  0x68, 0x8A, 0x71, 0x19,  // 236:26762
-  0x68, 0xFB, 0x71, 0x19,  // 237:26875
-  0x69, 0x6C, 0x71, 0x19,  // 238:26988
-  0x69, 0xDD, 0x71, 0x19,  // 239:27101
-  0x6A, 0x4E, 0x88, 0x19,  // 240:27214
-  0x6A, 0xD6, 0x7D, 0x19,  // 241:27350
-  0x6B, 0x53, 0x88, 0x19,  // 242:27475
-  0x6B, 0xDB, 0x88, 0x19,  // 243:27611
-  0x6C, 0x63, 0x88, 0x19,  // 244:27747
-  0x6C, 0xEB, 0x88, 0x19,  // 245:27883
-  0x6D, 0x73, 0x88, 0x19,  // 246:28019
-  0x6D, 0xFB, 0x88, 0x19,  // 247:28155
-  0x6E, 0x83, 0x8E, 0x19,  // 248:28291
-  0x6F, 0x11, 0x83, 0x19,  // 249:28433
-  0x6F, 0x94, 0x83, 0x19,  // 250:28564
-  0x70, 0x17, 0x83, 0x19,  // 251:28695
-  0x70, 0x9A, 0x83, 0x19,  // 252:28826
-  0x71, 0x1D, 0x8D, 0x19,  // 253:28957
-  0x71, 0xAA, 0x88, 0x19,  // 254:29098
-  0x72, 0x32, 0x8D, 0x19,  // 255:29234
+  0x00, 0x00, 0x7E, 0x2A,  // 35:0
+  0xFF, 0xFF, 0x00, 0x00,  // 36:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 37:65535
+  0x00, 0x7E, 0x5E, 0x2A,  // 38:126
+  0xFF, 0xFF, 0x00, 0x00,  // 39:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 40:65535
+  0x00, 0xDC, 0x51, 0x2A,  // 41:220
+  0xFF, 0xFF, 0x00, 0x00,  // 42:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 43:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 44:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 45:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 46:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 47:65535
+  0x01, 0x2D, 0x84, 0x2A,  // 48:301
+  0xFF, 0xFF, 0x00, 0x00,  // 49:65535
+  0x01, 0xB1, 0x25, 0x2A,  // 50:433
+  0x01, 0xD6, 0x6D, 0x2A,  // 51:470
+  0x02, 0x43, 0x66, 0x2A,  // 52:579
+  0x02, 0xA9, 0x49, 0x2A,  // 53:681
+  0xFF, 0xFF, 0x00, 0x00,  // 54:65535
+  0x02, 0xF2, 0x53, 0x2A,  // 55:754
+  0xFF, 0xFF, 0x00, 0x00,  // 56:65535
+  0x03, 0x45, 0x3A, 0x2A,  // 57:837
+  0xFF, 0xFF, 0x00, 0x00,  // 58:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 59:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 60:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 61:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 62:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 63:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 64:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 65:65535
+  0x03, 0x7F, 0x5F, 0x2A,  // 66:895
+  0xFF, 0xFF, 0x00, 0x00,  // 67:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 68:65535
+  0x03, 0xDE, 0x3F, 0x2A,  // 69:990
+  0x04, 0x1D, 0x2D, 0x2A,  // 70:1053
+  0xFF, 0xFF, 0x00, 0x00,  // 71:65535
+  0x04, 0x4A, 0x91, 0x2A,  // 72:1098
+  0xFF, 0xFF, 0x00, 0x00,  // 73:65535
+  0x04, 0xDB, 0x40, 0x2A,  // 74:1243
+  0xFF, 0xFF, 0x00, 0x00,  // 75:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 76:65535
+  0x05, 0x1B, 0x0C, 0x2A,  // 77:1307
+  0xFF, 0xFF, 0x00, 0x00,  // 78:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 79:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 80:65535
+  0x05, 0x27, 0x75, 0x2A,  // 81:1319
+  0x05, 0x9C, 0x8A, 0x2A,  // 82:1436
+  0x06, 0x26, 0x47, 0x2A,  // 83:1574
+  0xFF, 0xFF, 0x00, 0x00,  // 84:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 85:65535
+  0x06, 0x6D, 0x6A, 0x2A,  // 86:1645
+  0x06, 0xD7, 0xA0, 0x2A,  // 87:1751
+  0xFF, 0xFF, 0x00, 0x00,  // 88:65535
+  0x07, 0x77, 0x7F, 0x2A,  // 89:1911
 
   // Font Data:
-  0x00,0x00,0xE7,0x00,0x00,0x00,0x00,0x00,0xE7,0x00,0x00,0x00,0x00,0x00,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x00,0x10,0xE0,0x00,0x00,0x00,0x00,0xF0,0xE1,0x00,0x00,0x00,0x00,0xFC,0x47,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0xC0,0x01,0x00,0xC0,0xFF,0x3F,0xF0,0x03,0x00,0xE0,0xFF,0x3F,0xFC,0x03,0x00,0xF0,0xFF,0x7F,0xF0,0x03,0x00,0xF0,0xFF,0x7F,0xC0,0x01,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x38,0x00,0xF0,0xFF,0x7F,0x00,0x7E,0x00,0xF0,0xFF,0x7F,0x80,0x7F,0x00,0xE0,0xFF,0x3F,0x00,0x7E,0x00,0xC0,0xFF,0x3F,0x00,0x38,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x01, // 33
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x81,0x21,0x00,0xFC,0xFF,0xFF,0xC3,0x71,0x00,0xFC,0xFF,0xFF,0xC3,0x7F,0x00,0xFE,0xFF,0xFF,0x87,0x3F,0x00,0xFE,0xFF,0xFF,0x87,0x3F,0x00,0xFE,0xFF,0xFF,0xFF,0xF1,0x03,0xFE,0xFF,0xFF,0xFF,0xF1,0x03,0xFE,0xFF,0xFF,0xFF,0xF1,0x03,0xFE,0xFF,0xFF,0x87,0x3F,0x00,0xFE,0xFF,0xFF,0x87,0x3F,0x00,0xFC,0xFF,0xFF,0xC3,0x7F,0x00,0xFC,0xFF,0xFF,0xC3,0x71,0x00,0xFC,0xFF,0xFF,0xC3,0x71,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 34
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x80,0x00,0x00,0x00,0xFF,0x3F,0xC0,0x00,0x00,0x80,0xFF,0x7F,0xF8,0x00,0x00,0x80,0xFF,0x7F,0xF0,0x07,0x00,0xC0,0xFF,0xFF,0xB0,0x03,0x00,0xC0,0xFF,0xFF,0xBC,0x01,0x00,0xC0,0xFF,0xFF,0xE0,0x03,0x00,0xC0,0xFF,0xFF,0x60,0x03,0x00,0xC0,0xFF,0xFF,0x20,0x00,0x00,0xE0,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x83,0xE3,0x00,0xFE,0xFF,0xFF,0x83,0xF3,0x00,0xFE,0xFF,0xFF,0x03,0x7F,0x00,0xFE,0xFF,0xFF,0x07,0x7F,0x00,0xFE,0xFF,0xFF,0x87,0x7F,0x00,0xFE,0xFF,0xFF,0xF7,0xE3,0x07,0xFE,0xFF,0xFF,0xF7,0xE3,0x07,0xFE,0xFF,0xFF,0x87,0x7F,0x00,0xFE,0xFF,0xFF,0x07,0x7F,0x00,0xFE,0xFF,0xFF,0x03,0x7F,0x00,0xFE,0xFF,0xFF,0x83,0xF3,0x00,0xFC,0xFF,0xFF,0x83,0xE3,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x80,0x01,0x00,0xC0,0xFF,0xFF,0x80,0x09,0x00,0xC0,0xFF,0xFF,0x80,0x0F,0x00,0xC0,0xFF,0xFF,0xE0,0x07,0x00,0xC0,0xFF,0xFF,0xC0,0x1C,0x00,0x80,0xFF,0x7F,0x80,0x1F,0x00,0x80,0xFF,0x7F,0xC0,0x07,0x00,0x00,0xFF,0x3F,0x40,0x06,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 35
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x7F,0x38,0x00,0x00,0x80,0xFF,0x7F,0x7C,0x00,0x00,0xC0,0xFF,0x7F,0x7C,0x00,0x00,0xC0,0xFF,0xFF,0x7C,0x00,0x00,0xC0,0xFF,0x7F,0x38,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0xC0,0x01,0xF0,0xFF,0x7F,0x00,0xE0,0x03,0xF8,0xFF,0xFF,0x00,0xE0,0x03,0xF8,0xFF,0xFF,0x00,0xE0,0x03,0xFC,0xFF,0xFF,0x01,0xC0,0x01,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0xC3,0x01,0x00,0xFE,0xFF,0xFF,0xE3,0x03,0x00,0xFE,0xFF,0xFF,0xE3,0x03,0x00,0xFE,0xFF,0xFF,0xE3,0x03,0x00,0xFE,0xFF,0xFF,0xC3,0x01,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x01,0xC0,0x01,0xF8,0xFF,0xFF,0x00,0xE0,0x03,0xF0,0xFF,0x7F,0x00,0xE0,0x03,0xE0,0xFF,0x7F,0x00,0xE0,0x03,0xC0,0xFF,0x7F,0x00,0xC0,0x01,0xC0,0xFF,0x7F,0x38,0x00,0x00,0xC0,0xFF,0xFF,0x7C,0x00,0x00,0xC0,0xFF,0x7F,0x7C,0x00,0x00,0x80,0xFF,0x7F,0x7C,0x00,0x00,0x80,0xFF,0x7F,0x38,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 36
-  0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x07,0x00,0x00,0xF8,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x07,0x00,0x00,0xFC,0xFF,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0xFF,0x1F,0x00,0x80,0xFF,0xFF,0xFF,0x1F,0x00,0xC0,0xFF,0xFF,0xFF,0x1F,0x00,0xC0,0xFF,0xFF,0xFF,0x1F,0x00,0xE0,0xFF,0xFF,0xFF,0x1F,0x00,0xE0,0xFF,0xFF,0xFF,0x1F,0x00,0xE0,0xFF,0xFF,0xFF,0x0F,0x00,0xE0,0xFF,0xFF,0xFF,0x0F,0x00,0xE0,0xFF,0xFF,0xFF,0x0F,0x00,0xE0,0xFF,0xFF,0xFF,0x07,0x00,0xC0,0xFF,0xFF,0xFF,0x03,0x00,0xC0,0xFF,0xFF,0xFF,0x07,0x00,0x80,0xFF,0xFF,0xFF,0x07,0x00,0x80,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xEF,0x7F,0x00,0x00,0x00,0xE0,0x83,0x1F,  // 37
-  0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x3F,0x00,0x00,0xC0,0xFF,0xFF,0x3F,0x00,0x00,0xE0,0xFF,0xFF,0x7F,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x05,0x03,0xF0,0xFF,0xFF,0xFF,0xCF,0x01,0xF0,0xFF,0xFF,0xFF,0xFF,0x00,0xF8,0xFF,0xFF,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0xFF,0x7F,0x00,0xFE,0xFF,0xFF,0xFF,0x39,0x00,0xFE,0xFF,0xFF,0xFF,0x31,0x00,0xFF,0xFF,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0xFF,0x7F,0x00,0x00,0xFC,0xFF,0xFF,0x7F,0x00,0x00,0xF8,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0x3F,0x00,0x00,0xF0,0xFF,0xFF,0x3F,0x00,0x00,0xF0,0xFF,0xFF,0x1F,0x00,0x00,0xE0,0xFF,0xFF,0x1F,0x00,0x00,0xC0,0xFF,0xFF,0x0F,0x00,0x00,0x80,0x7F,0xFE,0x07,0x00,0x00,0x00,0x3F,0xF8, // 38
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0xF0,0xFF,0xFF,0xFF,0x7F,0x00,0xF8,0xFF,0xFF,0xFF,0x7F,0x00,0xF8,0xFF,0xFF,0xFF,0x7F,0x00,0xF8,0xFF,0xFF,0xFF,0x7F,0x00,0xF0,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x80,0x0F, // 39
-  0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFF,0x01,0xFE,0x07,0x00,0x80,0x7F,0x00,0xF0,0x0F,0x00,0xC0,0x1F,0x00,0xC0,0x1F,0x00,0xE0,0x0F,0x00,0x80,0x3F,0x00,0xF0,0x07,0x00,0x00,0x7F,0x00,0xF0,0x03,0x00,0x00,0x7E,0x00,0xF8,0x01,0x00,0x00,0xFC,0x00,0xF8,0x00,0x00,0x00,0xF8,0x00,0xFC,0x00,0x00,0x10,0xF8,0x01,0x7C,0x00,0x00,0x0C,0xF0,0x01,0x7C,0x00,0x00,0x0F,0xF0,0x01,0x7E,0x00,0xC0,0x07,0xF0,0x03,0x3E,0x00,0xF0,0x07,0xE0,0x03,0x3E,0x00,0xF8,0x03,0xE0,0x03,0x3E,0x00,0xFC,0x03,0xE0,0x03,0x3E,0x00,0xFC,0x01,0xE0,0x03,0x3E,0x00,0xFE,0x01,0xE0,0x03,0x3E,0x00,0xFE,0x00,0xE0,0x03,0x3E,0x00,0xFF,0x00,0xE0,0x03,0x3E,0x00,0x3F,0x00,0xE0,0x03,0x7E,0x80,0x0F,0x00,0xF0,0x03,0x7C,0x80,0x03,0x00,0xF0,0x01,0x7C,0xC0,0x01,0x00,0xF0,0x01,0xFC,0x40,0x00,0x00,0xF8,0x01,0xF8,0x00,0x00,0x00,0xF8,0x00,0xF8,0x01,0x00,0x00,0xFC,0x00,0xF0,0x03,0x00,0x00,0x7E,0x00,0xF0,0x07,0x00,0x00,0x7F,0x00,0xE0,0x0F,0x00,0x80,0x3F,0x00,0xC0,0x1F,0x00,0xC0,0x1F,0x00,0x80,0x7F,0x00,0xF0,0x0F,0x00,0x00,0xFF,0x01,0xFE,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0x03,  // 40
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x80,0x8F,0x03,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x80,0x9F,0x03,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x08,  // 41
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xC0,0x0C,0x00,0x00,0x00,0x00,0xC0,0x08,0x00,0x00,0x00,0x00,0x80,0x0C,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0xC0,0x03,0x1E,0x00,0x00,0x00,0xC0,0x01,0x1C,0x00,0x00,0x00,0xC0,0x01,0x1C,0x00,0x00,0x00,0xC0,0x01,0x1C,0x00,0x00,0x00,0xC0,0x01,0x1C,0x00,0x00,0x00,0x80,0x03,0x0E,0x00,0x00,0x00,0x80,0x01,0x0C,  // 42
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xC0,0x0C,0x00,0x00,0x00,0x00,0xC0,0x0C,0x00,0x00,0x00,0x00,0xC0,0x0C,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01, // 43
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7C,0x10,0x00,0x00,0x00,0x00,0xFE,0x10,0x00,0x00,0x00,0x00,0xFE,0x1C,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,  // 44
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,  // 45
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x38, // 46
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x01,  // 47
-  0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x80,0x07,0x0F,0x00,0x00,0x00,0xC0,0x03,0x1E,0x00,0x00,0x00,0xC0,0x01,0x1C,0x00,0x00,0x00,0xE0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xFF,0x00,0x38,0x00,0x00,0x80,0x7F,0x00,0x3C,0x00,0x00,0xC0,0x3F,0x00,0x3C,0x00,0x00,0xE0,0x1D,0x00,0x18,0x00,0x00,0xF0,0x1E,0x00,0x00,0x00,0x00,0x70,0x0E,0x00,0xC0,0x00,0x01,0x70,0x0E,0x00,0xC0,0xE1,0x00,0x70,0x07,0x00,0xE0,0x7F,0x00,0xF8,0x07,0x00,0xF0,0x3F,0x00,0x7C,0x07,0x00,0xF0,0x1F,0x00,0x3C,0x07,0x00,0xB8,0x0F,0x00,0x1C,0x07,0x00,0x0C,0x06,0x00,0x0E,0x07,0x00,0x02,0x00,0x00,0x0E,0x0F,0x00,0x40,0x00,0x00,0x0E,0x0E,0x00,0xE0,0x00,0x00,0x0E,0x1E,0x00,0xF0,0x00,0x00,0x0E,0x1C,0x00,0x70,0x00,0x00,0x0E,0x3C,0x00,0x3C,0x00,0x00,0x1E,0x78,0x00,0x1C,0x00,0x00,0x1C,0xF0,0x00,0x38,0x00,0x00,0x3C,0xE0,0x00,0x38,0x00,0x00,0xF8,0xE0,0x00,0x38,0x00,0x00,0x70,0xE0,0x00,0x38,0x00,0x00,0x70,0xE0,0x00,0x38,0x00,0x00,0x70,0xC0,0x01,0x3C,0x00,0x00,0xF0,0xC0,0x01,0x1C,0x00,0x00,0xE0,0x80,0x03,0x1E,0x00,0x00,0xE0,0xC3,0x07,0x0F,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFC,0x03,0x00,0x00,0x00,0x3E,0xF8, // 48
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x0C,0x00,0x80,0x01,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x18,0xFC,0x61,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0xE0,0xE3,0xFF,0x3F,0x1F,0x00,0xE0,0xE3,0xFF,0x3F,0x1F,0x00,0xE0,0xE3,0xFF,0x3F,0x1F,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x18,0xFC,0x61,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x0C,0x00,0x80,0x01,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70, // 49
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x02,  // 50
-  0x00,0x00,0x07,0xF0,0x01,0x00,0x00,0x00,0x07,0xFC,0x07,0x00,0x00,0x00,0x07,0xFF,0x0F,0x00,0x00,0x00,0x87,0xFF,0x1F,0x00,0x00,0x00,0x87,0xFF,0x3F,0x00,0xC0,0x00,0xC0,0xFF,0x7F,0x00,0xC0,0x01,0xC0,0xFF,0x7F,0x00,0xC0,0x03,0xC0,0xFF,0x7F,0x00,0x80,0x83,0xEF,0xFF,0x7F,0x00,0x00,0xE0,0xFF,0xFF,0x7F,0x00,0x00,0xF0,0xFF,0xFF,0x7F,0x00,0x00,0x78,0xF0,0xFF,0x7F,0x00,0x00,0x3C,0xF0,0xFF,0x7F,0x00,0x00,0x1C,0xF8,0xFF,0x7F,0x00,0x00,0x1E,0xFC,0xFF,0xFF,0x00,0x00,0x0E,0xFC,0xFF,0xFF,0x01,0x3E,0x0E,0xFE,0xFF,0xFF,0x01,0x3E,0x0E,0xFE,0xFF,0xFF,0x01,0x3E,0x0E,0xFF,0xFF,0xFF,0x03,0x00,0x0E,0xFF,0xFF,0xFF,0x03,0x00,0x1E,0xFF,0xFF,0xFF,0x03,0x00,0x1C,0xFF,0xFF,0xFF,0x03,0x00,0x3C,0xFF,0xFF,0xFF,0x03,0x00,0x78,0xFF,0xFF,0xFF,0x03,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0x00,0xE1,0xFF,0xFF,0xFF,0x01,0x80,0x01,0xFF,0xFF,0xFF,0x01,0xC0,0x01,0xFC,0xFF,0xFF,0x00,0xE0,0x00,0xFC,0xFF,0xFF,0x00,0x60,0x00,0xFA,0xFF,0x7F,0x00,0x00,0x00,0xF7,0xFF,0x7F,0x00,0x00,0x00,0xE7,0xFF,0x7F,0x00,0x00,0x00,0xE7,0xFF,0x7F,0x00,0x00,0x00,0xE7,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF8,0x01, // 51
-  0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x01,0x00,0x00,0xFE,0xFF,0xFF,0x01,0x00,0x00,0xFF,0xFF,0xFF,0x01,0x00,0x00,0xFF,0xFF,0xFF,0x03,0x00,0xFC,0xFF,0xFF,0xFF,0x03,0x00,0xFF,0xFF,0xFF,0xFF,0x03,0xC0,0xFF,0xFF,0xFF,0xFF,0x03,0xE0,0x03,0xFE,0xFF,0xFF,0x03,0xE0,0x01,0xFE,0xFF,0xFF,0x03,0xF0,0x01,0xFE,0xFF,0xFF,0x01,0xF8,0x1F,0xFE,0xFF,0xFF,0x01,0xF8,0x3F,0xFC,0xFF,0xFF,0x01,0x10,0xFC,0xFC,0xFF,0xFF,0x00,0x00,0xF0,0xF8,0xFF,0x7F,0x00,0x00,0xE0,0xF1,0xFF,0x3F,0x00,0x00,0xC0,0xE3,0xFF,0x7F,0x00,0x00,0x80,0xE3,0xFF,0x7F,0x00,0x00,0x80,0xE3,0xFF,0x7F,0x00,0x00,0x80,0xF7,0xFF,0x7F,0x00,0x00,0x80,0xF7,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0x80,0xDF,0xFF,0x3F,0x00,0x00,0x80,0xCF,0xFF,0x3F,0x00,0x00,0x80,0x83,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF8,0x01, // 52
-  0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,  // 53
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x33,0x20,0x00,0xFE,0xFF,0xFF,0x7B,0x1C,0x00,0xFE,0xFF,0xFF,0xFF,0x0F,0x00,0xFE,0xFF,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0xFF,0xFF,0x03,0x00,0xFE,0xFF,0xFF,0xE7,0x01,0x00,0xFE,0xFF,0xFF,0xC3,0x01,0x00,0xFE,0xFF,0xFF,0x83,0x00,0x00,0xFE,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 54
-  0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFF,0xFF,0x03,0x00,0x00,0x80,0xFF,0xFF,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0xFF,0x1F,0x38,0x00,0xF8,0xFF,0xFF,0x1F,0x7E,0x00,0xF8,0xFF,0xFF,0x9F,0x7F,0x00,0xF8,0xFF,0xFF,0x1F,0x7E,0x00,0xF8,0xFF,0xFF,0x1F,0x38,0x00,0xF8,0xFF,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0x80,0xFF,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F, // 55
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xC0,0x00,0x00,0xC0,0xFF,0xFF,0xF0,0x01,0x00,0xC0,0xFF,0xFF,0xF8,0x03,0x00,0xE0,0xFF,0xFF,0xF0,0x01,0x00,0xF0,0xFF,0xFF,0xC0,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x07,0xC0,0x01,0xFE,0xFF,0xFF,0x07,0xF0,0x03,0xFE,0xFF,0xFF,0x07,0xFC,0x03,0xFE,0xFF,0xFF,0x07,0xF0,0x03,0xFE,0xFF,0xFF,0x07,0xC0,0x01,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xFC,0xFF,0xFF,0x03,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x38,0x00,0xE0,0xFF,0xFF,0x00,0x7E,0x00,0xC0,0xFF,0xFF,0x80,0x7F,0x00,0xC0,0xFF,0xFF,0x00,0x7E,0x00,0xC0,0xFF,0xFF,0x00,0x38,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 56
-  0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x38,0x77,0x00,0x00,0x00,0x00,0x38,0x77,0x00,0x00,0x00,0x00,0x38,0x77,0x00,0x00,0x00,0x00,0x38,0x77,0x00,0x00,0x00,0x00,0x38,0x77,0x00,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x00,0x38,0x70,0x00,0x00,0x00,0x00,0x10,0x70,0x00,0x00,0x00,0x00,0xF0,0x71,0x00,0x00,0x00,0x00,0xFC,0x27,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x01,  // 57
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0xFE,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0xFE,0x00,0x00,0x00,0xFE,0x00,0xFE,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0x38,0x00,0x38, // 58
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x7C,0x00,0x7C,0x10,0x00,0x00,0xFE,0x00,0xFE,0x10,0x00,0x00,0xFE,0x00,0xFE,0x1C,0x00,0x00,0xFE,0x00,0xFE,0x1F,0x00,0x00,0x7C,0x00,0xFC,0x1F,0x00,0x00,0x38,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,  // 59
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0x00,0x00,0xEF,0x01,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x80,0xC7,0x03,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1E,0x00,0xF0, // 60
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03,0x00,0x00,0x00,0x00,0x87,0x03, // 61
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0x70,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0xC0,0x01,0x07,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x80,0xC7,0x03,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x00,0xEF,0x01,0x00,0x00,0x00,0x00,0xEE,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x10,  // 62
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x3C,0xFC,0x00,0x00,0x07,0x00,0x3F,0xFC,0x00,0x00,0x07,0x80,0x3F,0xFC,0x00,0x00,0x07,0xC0,0x3F,0xFC,0x00,0x00,0x07,0xE0,0x03,0x78,0x00,0x00,0x07,0xF0,0x01,0x00,0x00,0x00,0x07,0xF8,0x00,0x00,0x00,0x00,0x0F,0x7C,0x00,0x00,0x00,0x00,0x1E,0x3F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0x00,0xF0,  // 63
-  0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x00,0xF8,0x07,0xF0,0x0F,0x00,0x00,0xFC,0x00,0x80,0x1F,0x00,0x00,0x3E,0xE0,0x07,0x3E,0x00,0x00,0x1E,0xF8,0x0F,0x3C,0x00,0x00,0x0F,0xFE,0x1F,0x78,0x00,0x00,0x07,0x1F,0x3C,0x70,0x00,0x80,0x07,0x07,0x38,0xF0,0x00,0x80,0x83,0x07,0x38,0xE0,0x00,0x80,0x83,0x03,0x38,0xE0,0x00,0x80,0x83,0x03,0x1C,0xE0,0x00,0x80,0x83,0x03,0x1E,0xE0,0x00,0x80,0x83,0x03,0x07,0xE0,0x00,0x80,0x87,0xFF,0x0F,0x70,0x00,0x00,0x87,0xFF,0x1F,0x70,0x00,0x00,0x87,0xFF,0x3F,0x38,0x00,0x00,0x0F,0x00,0x38,0x00,0x00,0x00,0x1E,0x00,0x38,0x00,0x00,0x00,0x7C,0x00,0x3C,0x00,0x00,0x00,0xF8,0x03,0x1E,0x00,0x00,0x00,0xF0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,0x01,  // 64
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0x80,0x61,0x1C,0x00,0x00,0x00,0x00,0x70,0x1C,0x00,0x00,0x00,0x00,0x78,0x1C,0x00,0x00,0x00,0x00,0x3C,0x9C,0x03,0x00,0x00,0x00,0x1E,0x9C,0x03,0x00,0x00,0x00,0x0E,0x9C,0x03,0x00,0x00,0x00,0x07,0x9C,0x03,0x00,0x00,0x00,0x07,0x9C,0x03,0x00,0x00,0x1E,0x07,0x9C,0x03,0x00,0x00,0x3E,0x07,0x9C,0x03,0x00,0x00,0x1E,0x07,0x9C,0x03,0x00,0x00,0x00,0x07,0x9C,0x03,0x00,0x00,0x00,0x0E,0x9C,0x03,0x00,0x00,0x00,0x0E,0x9C,0x03,0x00,0x00,0x00,0x3C,0x9C,0x03,0x00,0x00,0x00,0x7C,0x1C,0x00,0x00,0x00,0x00,0x78,0x1C,0x00,0x00,0x00,0x80,0x61,0x1C,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0xE0,  // 65
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x01,0x00,0x00,0x0E,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x18,0xF8,0x60,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xC0,0x07,0x0F,0x00,0x00,0x00,0xE0,0x01,0x1E,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x3C,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0xE0,0x73,0x00,0x38,0x1F,0x00,0xE0,0x73,0x00,0x38,0x1F,0x00,0xE0,0x73,0x00,0x38,0x1F,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x01,0x1E,0x00,0x00,0x00,0xC0,0x07,0x0F,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0x18,0xF8,0x60,0x00,0x00,0x00,0x1C,0x00,0xE0,0x01,0x00,0x00,0x0E,0x00,0xC0,0x03,0x00,0x00,0x06,0x70,0x80,0x01,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70, // 66
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xC0,0xFF,0x0F,0x00,0x00,0x00,0xE0,0x03,0x1F,0x00,0x00,0x00,0x70,0x00,0x3C,0x00,0x00,0x00,0xF0,0x07,0x38,0x00,0x00,0x00,0xF8,0x1F,0x38,0x00,0x00,0x00,0xF8,0x3F,0x70,0x00,0x00,0x00,0x18,0x7C,0x70,0x00,0x00,0x00,0x00,0xF0,0x70,0x00,0x00,0x00,0x00,0xE0,0x71,0x00,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0x00,0xC0,0x73,0x00,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xC0,0x03,  // 67
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x1C,0x40,0x00,0x03,0x00,0x00,0x3C,0x00,0x80,0x07,0x00,0x00,0x38,0x00,0xC0,0x03,0x00,0x00,0x30,0xF0,0xC1,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0F,0x1E,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0xC0,0x01,0x30,0x00,0x00,0x00,0xC0,0xFD,0x77,0x00,0x00,0x00,0xC0,0xFE,0x6F,0x00,0x00,0xC0,0xC7,0xFF,0x7F,0x7C,0x00,0xC0,0xE7,0xFF,0x7F,0x7C,0x00,0xC0,0xC7,0xFF,0x7F,0x7C,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,  // 68
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x00,0xE0,0x38,0x07,0x00,0x00,0x00,0xE0,0x38,0x07,0x00,0x00,0x00,0xE0,0x38,0x07,0x00,0x00,0x00,0xE0,0x38,0x07,0x00,0x00,0x00,0xE0,0x38,0x07,0x00,0x00,0x00,0xE0,0xFE,0x07,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0xF0,0x39,0x0F,0x00,0x00,0x00,0xF8,0x38,0x1F,0x00,0x00,0x00,0xFC,0x38,0x3F,0x00,0x00,0x00,0xFC,0x38,0x3F,0x00,0x00,0x00,0xEC,0x38,0x37,0x00,0x00,0x00,0xEE,0x38,0x77,0x00,0x00,0x00,0xEE,0x38,0x77,0x00,0x00,0x00,0xEE,0x38,0x77,0x00,0x00,0x00,0xEE,0x38,0x77,0x00,0x00,0x00,0x4E,0x38,0x77,0x00,0x00,0x00,0x0E,0x38,0x77,0x00,0x00,0x00,0x0E,0x38,0x77,0x00,0x00,0x00,0x1C,0x38,0x37,0x00,0x00,0x00,0x3C,0x38,0x3F,0x00,0x00,0x00,0x38,0x38,0x3F,0x00,0x00,0x00,0x78,0x38,0x1F,0x00,0x00,0x00,0xF0,0x39,0x0F,0x00,0x00,0x00,0xE0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0x38,0x07,0x00,0x00,0x00,0x00,0x38,0x07,0x00,0x00,0x00,0x00,0x38,0x02,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38, // 69
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0x00,0xE7,0x1C,0x00,0x00,0x00,0xE0,0xE7,0x1C,0x00,0x00,0x00,0xE0,0xE7,0x1C,0x00,0x00,0x00,0xF0,0xE7,0x1C,0x00,0x00,0x00,0xF0,0xE7,0x1C,0x00,0x00,0x00,0xF0,0xE7,0x1C,0x00,0x00,0x00,0xF0,0xE7,0xFC,0x00,0x00,0x00,0xE0,0xE3,0xFC,0x01,0x00,0x00,0xC0,0xE1,0xFC,0x03,0x00,0x00,0x00,0xE0,0xFC,0x03,0x00,0x00,0x00,0xE0,0xFC,0x03,0x00,0x00,0x00,0xE0,0xFC,0x03,0x00,0x00,0x00,0xE0,0xF8,0x01,0x00,0x00,0x00,0xFC,0xF0,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x3C, // 70
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x0E,0x00,0x00,0x00,0x80,0x07,0x1F,0x00,0x00,0x00,0x80,0x8F,0x1F,0x00,0x00,0x00,0x80,0x8F,0x1F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xDF,0xFF,0x01,0x00,0x00,0xFE,0x8F,0xFF,0x03,0x00,0x00,0xFE,0x8F,0xFF,0x03,0x00,0x00,0xFE,0x8F,0xFF,0x03,0x00,0x00,0xFC,0x8F,0xFF,0x01,0x00,0x00,0x80,0xDF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0xFF,0x0F,0x00,0x00,0x00,0x80,0x8F,0x1F,0x00,0x00,0x00,0x80,0x8F,0x1F,0x00,0x00,0x00,0x80,0x07,0x1F,0x00,0x00,0x00,0x00,0x07,0x0E,  // 71
-  0x00,0x00,0x07,0xF8,0x01,0x00,0x00,0x00,0x07,0xFE,0x07,0x00,0x00,0x00,0x07,0xFF,0x0F,0x00,0x00,0x00,0x87,0x0F,0x1F,0x00,0x00,0x00,0xC7,0x03,0x3C,0x00,0xE0,0x00,0xC0,0x01,0x38,0x00,0xE0,0x03,0xC0,0x01,0x78,0x00,0xC0,0x07,0xE0,0x00,0x70,0x00,0x80,0x87,0xEF,0x00,0x70,0x00,0x00,0xE0,0xFF,0x00,0x70,0x00,0x00,0xF0,0xFF,0x00,0x70,0x00,0x00,0x78,0xF0,0x01,0x70,0x00,0x00,0x3C,0xF0,0x00,0x78,0x00,0x00,0x1C,0x78,0x00,0x78,0x00,0x00,0x1E,0x3C,0x00,0xF0,0x00,0x00,0x0E,0x1E,0x00,0xE0,0x00,0x3E,0x0E,0x0E,0x00,0xC0,0x01,0x3E,0x0E,0x0E,0x00,0xC0,0x01,0x3E,0x0E,0x07,0x00,0x80,0x03,0x00,0x0E,0x07,0x00,0x80,0x03,0x00,0x1E,0x07,0x00,0x80,0x03,0x00,0x1C,0x07,0x00,0x80,0x03,0x00,0x3C,0x07,0x00,0x80,0x03,0x00,0x78,0x07,0x00,0x80,0x03,0x00,0xF0,0x0F,0x00,0xC0,0x03,0x00,0xC1,0x0F,0x00,0xC0,0x01,0x80,0x03,0x0E,0x00,0xC0,0x01,0xC0,0x01,0x1C,0x00,0xE0,0x00,0xE0,0x00,0x3C,0x00,0x70,0x00,0x40,0x00,0x7F,0x00,0x78,0x00,0x00,0x00,0xF7,0x00,0x70,0x00,0x00,0x00,0xE7,0x00,0x70,0x00,0x00,0x00,0xE7,0x00,0x70,0x00,0x00,0x00,0xE7,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x01,0x78,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xC0,0x03,0x3C,0x00,0x00,0x00,0x80,0x0F,0x1F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF8,0x01, // 72
-  0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0x0F,0x1F,0x00,0x00,0x00,0xC0,0x03,0x3C,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xE0,0x01,0x78,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x38,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x1C,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x01,0x00,0x00,0x06,0x00,0xC0,0x01,0x00,0x00,0x07,0x00,0xC0,0x01,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0xF8,0x07,0x00,0x80,0x03,0x00,0xFF,0x03,0x00,0x80,0x03,0x80,0x87,0x07,0x00,0x80,0x03,0xC0,0x01,0x07,0x00,0x80,0x03,0xC0,0x00,0x07,0x00,0x80,0x03,0x60,0x00,0x06,0x00,0x80,0x03,0xE0,0x07,0x0E,0x00,0xC0,0x01,0xF0,0x1F,0x0E,0x00,0xC0,0x01,0xF0,0x7F,0x1C,0x00,0xE0,0x00,0x20,0xF8,0x1C,0x00,0xF0,0x00,0x00,0xE0,0x79,0x00,0x78,0x00,0x00,0xC0,0xF3,0x00,0x78,0x00,0x00,0x80,0xE3,0x00,0x70,0x00,0x00,0x80,0xE7,0x00,0x70,0x00,0x00,0x00,0xF7,0x00,0x70,0x00,0x00,0x00,0xF7,0x00,0x70,0x00,0x00,0x00,0xFF,0x01,0x78,0x00,0x00,0x00,0xDF,0x01,0x38,0x00,0x00,0x80,0xCF,0x03,0x3C,0x00,0x00,0x80,0x83,0x0F,0x1F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF8,0x01, // 73
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x07,0x80,0x73,0x0E,0x00,0x00,0x07,0x80,0x73,0x0E,0x00,0x00,0x0E,0x80,0x73,0x0E,0x00,0x00,0x0C,0x9E,0x73,0x0E,0x00,0x00,0x80,0x9F,0x73,0x0E,0x00,0x00,0xC0,0x9F,0x73,0x0E,0x00,0x00,0xE0,0x81,0x73,0x0E,0x00,0x00,0xF0,0x80,0x73,0x0E,0x00,0x00,0x70,0x80,0x73,0x0E,0x00,0x00,0x78,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0xF8,0x38,0x80,0x73,0x0E,0x00,0xF8,0x38,0x80,0x73,0x0E,0x00,0xF8,0x38,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x78,0x80,0x73,0x0E,0x00,0x00,0x70,0x80,0x73,0x0E,0x00,0x00,0xF0,0x80,0x73,0x0E,0x00,0x00,0xE0,0x81,0x73,0x0E,0x00,0x00,0xC0,0x9F,0x73,0x0E,0x00,0x00,0x80,0x9F,0x73,0x0E,0x00,0x00,0x0E,0x9E,0x73,0x0E,0x00,0x00,0x0F,0x80,0x73,0x0E,0x00,0x80,0x07,0x80,0x73,0x0E,0x00,0x00,0x03,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E,0x00,0x00,0x00,0x9C,0x73,0x0E, // 74
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0xF0,0x83,0x73,0x0E,0x00,0x00,0xFC,0x87,0x73,0x0E,0x00,0x00,0xFE,0x8F,0x73,0x0E,0x00,0x00,0x0F,0x8C,0x73,0x0E,0x00,0x80,0x03,0x80,0x73,0x0E,0x00,0x80,0x1F,0x80,0x73,0x0E,0x00,0xC0,0x7F,0x80,0x73,0x0E,0x00,0xC0,0xFF,0x80,0x73,0x0E,0x00,0x80,0xF0,0x81,0x73,0x0E,0x00,0x00,0xC0,0x83,0x73,0x0E,0x00,0x00,0x80,0x87,0x73,0x0E,0x00,0x00,0x00,0x87,0x73,0x0E,0x00,0x00,0x00,0x87,0x73,0x0E,0x00,0x00,0x00,0x8E,0x73,0x0E,0x00,0x00,0x00,0x8E,0x73,0x0E,0x00,0x00,0x00,0x8E,0x73,0x0E,0x00,0x00,0x00,0x8E,0x73,0x0E,0x00,0x00,0x00,0x8F,0x73,0x0E,0x00,0x00,0x00,0x8F,0x73,0x0E,0x00,0x00,0x00,0x87,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E,0x00,0x00,0x00,0x80,0x73,0x0E, // 75
-  0x00,0x00,0x9E,0x73,0x0E,0x00,0x00,0x80,0x9F,0x73,0x0E,0x00,0x00,0xC0,0x9F,0x73,0x0E,0x00,0x00,0xE0,0x81,0x73,0x0E,0x00,0x00,0xF0,0x80,0x73,0x0E,0x00,0x00,0x70,0x80,0x73,0x0E,0x00,0x00,0x78,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x3C,0x80,0x73,0x0E,0x00,0x00,0x1E,0x80,0x73,0x0E,0x00,0x00,0x0F,0x80,0x73,0x0E,0x00,0x00,0x07,0x80,0x73,0x0E,0x00,0x80,0x07,0x80,0x73,0x0E,0x00,0x80,0x03,0x80,0x73,0x0E,0x00,0xC0,0x03,0x80,0x73,0x0E,0x00,0xC0,0x01,0x80,0x73,0x0E,0x00,0xC0,0x01,0x80,0x73,0x0E,0x00,0xC0,0x01,0x80,0x73,0x0E,0x00,0xC0,0x01,0x80,0x73,0x0E,0x00,0xC0,0x01,0x80,0x73,0x0E,0x00,0xC0,0x01,0x80,0x73,0x0E,0x00,0xC0,0x03,0x80,0x73,0x0E,0x00,0x80,0x03,0x80,0x73,0x0E,0x00,0x80,0x07,0x80,0x73,0x0E,0x00,0x00,0x07,0x80,0x73,0x0E,0x00,0x00,0x0F,0x80,0x73,0x0E,0x00,0x00,0x1E,0x80,0x73,0x0E,0x00,0x00,0x3C,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x38,0x80,0x73,0x0E,0x00,0x00,0x78,0x80,0x73,0x0E,0x00,0x00,0x70,0x80,0x73,0x0E,0x00,0x00,0xF0,0x80,0x73,0x0E,0x00,0x00,0xE0,0x81,0x73,0x0E,0x00,0x00,0xC0,0x9F,0x73,0x0E,0x00,0x00,0x80,0x9F,0x73,0x0E,0x00,0x00,0x00,0x9E,0x73,0x0E, // 76
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,0x00,0x00,0x00,0x38,0xE7,0x1C,  // 77
-  0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0x0F,0x1F,0x00,0x00,0x00,0xC0,0x03,0x3C,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xE0,0x01,0x78,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x30,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x0E,0x00,0xC0,0x01,0x00,0x00,0x0E,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x30,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x01,0x78,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xC0,0x03,0x3C,0x00,0x00,0x00,0x80,0x0F,0x1F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,  // 78
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0xF0,0x00,0x00,0x00,0x38,0x00,0xE0,0x01,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0x80,0x33,0x20,0x00,0x1E,0x00,0x80,0x7B,0x1C,0x00,0x0E,0x00,0x00,0xFF,0x0F,0x00,0x0E,0x00,0x00,0xFF,0x07,0x00,0x0E,0x00,0x00,0xFF,0x03,0x00,0x0E,0x00,0x00,0xE7,0x01,0x00,0x0E,0x00,0x00,0xC3,0x00,0x00,0x0E,0x00,0x00,0x83,0x00,0x00,0x1E,0x00,0x80,0x03,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x38,0x00,0xE0,0x01,0x00,0x00,0x78,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 79
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0xF0,0x00,0x00,0x00,0x38,0x00,0xE0,0x01,0x00,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0x80,0x11,0x20,0x00,0x1E,0x00,0x80,0x38,0x1C,0x00,0x0E,0x00,0x00,0xFC,0x0F,0x00,0x0E,0x00,0x00,0xFE,0x07,0x00,0x0E,0x00,0x00,0xFF,0x03,0x00,0x0E,0x00,0x80,0xE7,0x01,0x00,0x0E,0x00,0xE0,0xC0,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x03,0x00,0x00,0x3C,0x00,0xC0,0x01,0x00,0x00,0x38,0x00,0xE0,0x01,0x00,0x00,0x78,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 80
-  0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xF8,0xF0,0x01,0x00,0x00,0x00,0x3C,0xC0,0x03,0x00,0x00,0x00,0x1C,0x80,0x03,0x00,0x00,0x00,0x1E,0x80,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x0F,0x00,0x03,0x00,0x00,0xC0,0x07,0x80,0x03,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0x78,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x1C,0x38,0x00,0x38,0x00,0x00,0x1C,0x7E,0x00,0x38,0x00,0x00,0x9C,0x7F,0x00,0x38,0x00,0x00,0x1C,0x7E,0x00,0x38,0x00,0x00,0x1C,0x38,0x00,0x78,0x00,0x00,0x1C,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x01,0x00,0x07,0x00,0x00,0xC0,0x03,0x80,0x03,0x00,0x00,0x80,0x0F,0x80,0x03,0x00,0x00,0x00,0x0F,0x00,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x0E,0x00,0x07,0x00,0x00,0x00,0x1C,0x80,0x03,0x00,0x00,0x00,0x1C,0x80,0x03,0x00,0x00,0x00,0x3C,0xC0,0x03,0x00,0x00,0x00,0xF8,0xF0,0x01,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0x1F, // 81
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0xC0,0x00,0x00,0xC0,0x01,0xE0,0xF0,0x01,0x00,0xC0,0x01,0xE0,0xF8,0x03,0x00,0xE0,0x01,0xE0,0xF0,0x01,0x00,0xF0,0x00,0x70,0xC0,0x00,0x00,0x78,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0xC0,0x03,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x80,0x07,0x00,0x00,0x0E,0x00,0x00,0x07,0xC0,0x01,0x0E,0x00,0x00,0x07,0xF0,0x03,0x0E,0x00,0x00,0x07,0xFC,0x03,0x0E,0x00,0x00,0x07,0xF0,0x03,0x0E,0x00,0x00,0x07,0xC0,0x01,0x0E,0x00,0x00,0x07,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x00,0x3C,0x00,0xC0,0x01,0x00,0x00,0x38,0x00,0xE0,0x01,0x00,0x00,0x78,0x00,0xE0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x38,0x00,0xE0,0x01,0xE0,0x00,0x7E,0x00,0xC0,0x01,0xE0,0x80,0x7F,0x00,0xC0,0x01,0xE0,0x00,0x7E,0x00,0xC0,0x01,0xE0,0x00,0x38,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x03,0xF0,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 82
-  0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x1C,0x77,0x00,0x00,0x00,0x00,0x1C,0x77,0x00,0x00,0x00,0x00,0x1C,0x77,0x00,0x00,0x00,0x00,0x1C,0x77,0x00,0x00,0x00,0x00,0x1C,0x77,0x00,0x00,0x00,0x00,0x1C,0x70,0x00,0x00,0x00,0x00,0x1C,0x70,0x00,0x00,0x00,0x00,0x08,0x70,0x00,0x00,0x00,0x00,0xF8,0x71,0x00,0x00,0x00,0x00,0xFE,0x77,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0x0F,0x0F,0x00,0x00,0x00,0x80,0x07,0x1E,0x00,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xE0,0x01,0x38,0x00,0x00,0x00,0xF0,0x00,0x38,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0x78,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x38,0x00,0x70,0x00,0x00,0x00,0x78,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x00,0x00,0xF0,0x00,0x38,0x00,0x00,0x00,0xE0,0x01,0x38,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x00,0x00,0x0F,0x0F,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,  // 83
-  0x00,0x00,0xE7,0x00,0x00,0x00,0x00,0x00,0xE7,0x00,0x00,0x00,0x00,0x00,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE7,0x00,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x00,0x10,0xE0,0x00,0x00,0x00,0x00,0xF0,0xE1,0x00,0x00,0x00,0x00,0xFC,0xE7,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x1F,0x3E,0x00,0x00,0x00,0x00,0x07,0x3C,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x03,0x70,0xC0,0x01,0x00,0xC0,0x03,0x70,0xF0,0x03,0x00,0xE0,0x01,0x70,0xFC,0x03,0x00,0xF0,0x00,0x70,0xF0,0x03,0x00,0x70,0x00,0xF0,0xC0,0x01,0x00,0x78,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x70,0x00,0xE0,0x00,0x38,0x00,0x70,0x00,0xF0,0x00,0x7E,0x00,0xF0,0x00,0x70,0x80,0x7F,0x00,0xE0,0x01,0x70,0x00,0x7E,0x00,0xC0,0x03,0x70,0x00,0x38,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x00,0x07,0x3C,0x00,0x00,0x00,0x00,0x0F,0x1E,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x01, // 84
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0xC0,0x03,0x70,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0xF0,0x00,0x00,0x00,0x38,0x00,0xE0,0x01,0x00,0x00,0x3C,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0x80,0xC3,0x71,0x00,0x1C,0x00,0x80,0xC3,0x7F,0x00,0x0E,0x00,0x00,0x87,0x3F,0x00,0x0E,0x00,0x00,0x87,0x3F,0x00,0x0E,0x00,0x00,0xFF,0xF1,0x03,0x0E,0x00,0x00,0xFF,0xF1,0x03,0x0E,0x00,0x00,0xFF,0xFF,0x03,0x0E,0x00,0x00,0x87,0x3F,0x00,0x1E,0x00,0x80,0xC3,0x7F,0x00,0x1C,0x00,0x80,0xC3,0x71,0x00,0x1C,0x00,0xC0,0x01,0x00,0x00,0x38,0x00,0xE0,0x01,0x00,0x00,0x78,0x00,0xF0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x03,0x70,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 85
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0xC0,0x03,0x70,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xF0,0x00,0x70,0x00,0x00,0x00,0x70,0x00,0x10,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x80,0x73,0x00,0x00,0x1C,0x00,0x80,0x7F,0x00,0x00,0x0E,0x00,0x00,0x3F,0x00,0x00,0x0E,0x00,0x80,0x7F,0x00,0x00,0x0E,0x00,0xF0,0xF3,0x03,0x00,0x0E,0x00,0xF0,0xF3,0x03,0x00,0x0E,0x00,0xF0,0xFF,0x03,0x00,0x0E,0x00,0x80,0x3F,0x00,0x00,0x1E,0x00,0x80,0x7F,0x00,0x00,0x1C,0x00,0x80,0x73,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x10,0x00,0x00,0x00,0xF0,0x01,0x70,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x03,0x70,0x00,0x00,0x00,0x80,0x03,0x70,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 86
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x80,0x00,0x00,0x00,0x0F,0x3C,0xC0,0x00,0x00,0x80,0x03,0x70,0xF8,0x00,0x00,0x80,0x03,0x70,0xF0,0x07,0x00,0xC0,0x01,0xE0,0xB0,0x03,0x00,0xC0,0x01,0xE0,0xBC,0x01,0x00,0xC0,0x01,0xC0,0xE0,0x03,0x00,0xC0,0x01,0xC0,0x60,0x03,0x00,0xC0,0x01,0xE0,0x20,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xF0,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x3C,0x00,0xC0,0x01,0x00,0x00,0x1C,0x00,0x80,0x83,0xE3,0x00,0x0E,0x00,0x80,0x83,0xF3,0x00,0x0E,0x00,0x00,0x03,0x7F,0x00,0x0E,0x00,0x00,0x07,0x7F,0x00,0x06,0x00,0x00,0x87,0x7F,0x00,0x06,0x00,0x00,0xF7,0xE3,0x07,0x06,0x00,0x00,0xF7,0xE3,0x07,0x06,0x00,0x00,0x87,0x7F,0x00,0x0E,0x00,0x00,0x07,0x7F,0x00,0x0E,0x00,0x00,0x03,0x7F,0x00,0x0E,0x00,0x80,0x83,0xF3,0x00,0x1C,0x00,0x80,0x83,0xE3,0x00,0x3C,0x00,0xC0,0x01,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0xF0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x80,0x01,0x00,0xC0,0x01,0xC0,0x80,0x09,0x00,0xC0,0x01,0xC0,0x80,0x0F,0x00,0xC0,0x01,0xE0,0xE0,0x07,0x00,0xC0,0x01,0xE0,0xC0,0x1C,0x00,0x80,0x03,0x70,0x80,0x1F,0x00,0x80,0x03,0x70,0xC0,0x07,0x00,0x00,0x0F,0x3C,0x40,0x06,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 87
-  0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x80,0x03,0x70,0x38,0x00,0x00,0xC0,0x01,0xE0,0x7C,0x00,0x00,0xC0,0x01,0xE0,0x7C,0x00,0x00,0xC0,0x01,0xE0,0x7C,0x00,0x00,0xC0,0x01,0xE0,0x38,0x00,0x00,0xE0,0x01,0xE0,0x00,0x00,0x00,0xF0,0x01,0xE0,0x00,0xC0,0x01,0xF0,0x00,0xF0,0x00,0xE0,0x03,0x78,0x00,0xE0,0x00,0xE0,0x03,0x3C,0x00,0xC0,0x01,0xE0,0x03,0x1C,0x00,0xC0,0x03,0xC0,0x01,0x1C,0x00,0x80,0x03,0x00,0x00,0x1E,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x00,0xC7,0x01,0x00,0x0E,0x00,0x00,0xE7,0x03,0x00,0x0E,0x00,0x00,0xE7,0x03,0x00,0x0E,0x00,0x00,0xE7,0x03,0x00,0x0E,0x00,0x00,0xC7,0x01,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x00,0x1C,0x00,0x80,0x03,0x00,0x00,0x3C,0x00,0xC0,0x01,0xC0,0x01,0x38,0x00,0xE0,0x01,0xE0,0x03,0x70,0x00,0xF0,0x00,0xE0,0x03,0xF0,0x00,0x70,0x00,0xE0,0x03,0xE0,0x01,0xE0,0x00,0xC0,0x01,0xC0,0x01,0xE0,0x00,0x00,0x00,0xC0,0x01,0xE0,0x38,0x00,0x00,0xC0,0x01,0xE0,0x7C,0x00,0x00,0xC0,0x01,0xE0,0x7C,0x00,0x00,0xC0,0x03,0x70,0x7C,0x00,0x00,0x80,0x03,0x70,0x38,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03, // 88
-  0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x80,0x0F,0x1F,0x00,0x00,0x00,0xC0,0x03,0x3C,0x00,0x00,0x00,0xC0,0x01,0x38,0x00,0x00,0x00,0xE0,0x01,0x78,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xE0,0x00,0x70,0x00,0x00,0x00,0xFE,0x01,0x70,0x00,0x00,0x80,0xFF,0x00,0x38,0x00,0x00,0xC0,0x3F,0x00,0x78,0x00,0x00,0xC0,0x1D,0x00,0xF0,0x00,0x00,0xE0,0x1F,0x00,0xE0,0x01,0x00,0xE0,0x0E,0x00,0xC0,0x01,0x00,0xE0,0x0E,0x00,0xC0,0x01,0x00,0xE0,0x07,0x00,0x80,0x03,0x00,0xF0,0x07,0x00,0x80,0x03,0x00,0x78,0x07,0x00,0x80,0x03,0x00,0x3C,0x07,0x00,0x80,0x03,0x00,0x1C,0x07,0x00,0x80,0x03,0x00,0x1E,0x07,0x00,0x80,0x03,0x00,0x0E,0x0F,0x00,0xC0,0x01,0x00,0x0E,0x0E,0x00,0xC0,0x01,0x00,0x0E,0x1E,0x00,0xE0,0x01,0x00,0x0E,0x1C,0x00,0xF0,0x00,0x00,0x0E,0x3C,0x00,0x78,0x00,0x00,0x1C,0x78,0x00,0x38,0x00,0x00,0x1C,0xF0,0x00,0x70,0x00,0x00,0x38,0xE0,0x00,0x70,0x00,0x00,0xF8,0xE0,0x00,0x70,0x00,0x00,0xE0,0xE0,0x00,0x70,0x00,0x00,0xE0,0xE0,0x00,0x70,0x00,0x00,0xE0,0xC0,0x01,0x78,0x00,0x00,0xE0,0xC0,0x01,0x38,0x00,0x00,0xC0,0x81,0x03,0x3C,0x00,0x00,0xC0,0xC3,0x0F,0x1F,0x00,0x00,0x80,0xFF,0xFF,0x0F,0x00,0x00,0x00,0xFF,0xFC,0x07,0x00,0x00,0x00,0x3E,0xF0,0x01, // 89
-  0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x80,0x07,0x0F,0x00,0x00,0x00,0xC0,0x03,0x1E,0x00,0x00,0x00,0xC0,0x01,0x1C,0x00,0x00,0x00,0xE0,0x01,0x3C,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xE0,0x00,0x38,0x00,0x00,0x00,0xFF,0x00,0x38,0x00,0x00,0x80,0x7F,0x00,0x1C,0x00,0x00,0xC0,0x3F,0x00,0x3C,0x00,0x00,0xE0,0x1D,0x00,0x78,0x00,0x00,0xF0,0x1E,0x00,0x70,0x00,0x00,0x70,0x0E,0x00,0xE0,0x02,0x02,0x70,0x0E,0x00,0xE0,0xC7,0x01,0x70,0x07,0x00,0xC0,0xFF,0x00,0xF8,0x07,0x00,0xC0,0x7F,0x00,0x7C,0x07,0x00,0xC0,0x7F,0x00,0x3C,0x07,0x00,0xC0,0x3D,0x00,0x1C,0x07,0x00,0xC0,0x19,0x00,0x0E,0x07,0x00,0xC0,0x00,0x00,0x0E,0x0F,0x00,0xE0,0x00,0x00,0x0E,0x0E,0x00,0xE0,0x00,0x00,0x0E,0x1E,0x00,0x70,0x00,0x00,0x0E,0x1C,0x00,0x78,0x00,0x00,0x0E,0x3C,0x00,0x3C,0x00,0x00,0x1E,0x78,0x00,0x1C,0x00,0x00,0x1C,0xF0,0x00,0x38,0x00,0x00,0x3C,0xE0,0x00,0x38,0x00,0x00,0xF8,0xE0,0x00,0x38,0x00,0x00,0x70,0xE0,0x00,0x38,0x00,0x00,0x70,0xE0,0x00,0x38,0x00,0x00,0x70,0xC0,0x01,0x3C,0x00,0x00,0xF0,0xC0,0x01,0x1C,0x00,0x00,0xE0,0x80,0x03,0x1E,0x00,0x00,0xE0,0xC3,0x07,0x0F,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFC,0x03,0x00,0x00,0x00,0x3E,0xF8, // 90
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,  // 91
-  0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x01,  // 92
-  0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,0xC0,0xFF,0xFF,0xFF,0xFF,0x1F,  // 93
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x20,  // 94
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,  // 95
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x20,  // 96
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x00,0x00,0x7C,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x00,0x0E,0x00,0x1E,0x00,0x00,0x00,0x0E,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xC0, // 97
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xE0,0x03,0xE0,0x00,0x00,0x00,0xF0,0x00,0xE0,0x00,0x00,0x00,0x78,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x00,0x1E,0x00,0x7C,0x00,0x00,0x00,0x1E,0x00,0x3E,0x00,0x00,0x00,0x7C,0x80,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0x80,0x7F,  // 98
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xF0,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x3C,0x00,0x70, // 99
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x00,0x00,0x7C,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x00,0x0E,0x00,0x1E,0x00,0x00,0x00,0x0E,0x80,0x0F,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF, // 100
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x1D,0x3F,0x00,0x00,0x00,0x7C,0x1C,0x7C,0x00,0x00,0x00,0x3C,0x1C,0x78,0x00,0x00,0x00,0x1C,0x1C,0x70,0x00,0x00,0x00,0x0E,0x1C,0xF0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x1E,0x1C,0xE0,0x00,0x00,0x00,0x1C,0x1C,0xE0,0x00,0x00,0x00,0x7C,0x1C,0x70,0x00,0x00,0x00,0xF8,0x1F,0x70,0x00,0x00,0x00,0xF0,0x1F,0x70,0x00,0x00,0x00,0xE0,0x1F,0x78,0x00,0x00,0x00,0x00,0x1F,0x38, // 101
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0x00,0xF8,0xFF,0xFF,0xFF,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0xFF,0xFF,0x00,0x00,0x1F,0x38,0x00,0x00,0x00,0x00,0x0F,0x38,0x00,0x00,0x00,0x80,0x07,0x38,0x00,0x00,0x00,0x80,0x07,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x07,  // 102
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x18,0x00,0x00,0x00,0xFF,0x1F,0x10,0x00,0x00,0xC0,0xFF,0x3F,0x10,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x00,0x00,0x7C,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x00,0x0E,0x00,0x1E,0x10,0x00,0x00,0x0E,0x80,0x0F,0x1C,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0xFF,0x01,  // 103
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF, // 104
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x0E,0x00,0x00,0x00,0x80,0x0F,0xFE,0xFF,0xFF,0x00,0x80,0x0F,0xFE,0xFF,0xFF,0x00,0x80,0x0F,0xFE,0xFF,0xFF,0x00,0x00,0x07,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0, // 105
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x10,0x00,0x07,0x0E,0x00,0x00,0x1C,0x80,0x0F,0xFE,0xFF,0xFF,0x1F,0x80,0x0F,0xFE,0xFF,0xFF,0x1F,0x80,0x0F,0xFE,0xFF,0xFF,0x1F,0x00,0x07,0xFE,0xFF,0xFF,0x07,  // 106
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x80,0xF7,0x01,0x00,0x00,0x00,0xC0,0xE3,0x03,0x00,0x00,0x00,0xE0,0xC1,0x07,0x00,0x00,0x00,0xF0,0x80,0x0F,0x00,0x00,0x00,0x78,0x00,0x1F,0x00,0x00,0x00,0x3C,0x00,0x3E,0x00,0x00,0x00,0x1E,0x00,0x7C,0x00,0x00,0x00,0x0E,0x00,0xF8,0x00,0x00,0x00,0x06,0x00,0xF0,0x00,0x00,0x00,0x02,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x80, // 107
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0, // 108
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF, // 109
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF, // 110
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,  // 111
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xE0,0x03,0xE0,0x00,0x00,0x00,0xF0,0x00,0xE0,0x00,0x00,0x00,0x78,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x00,0x1E,0x00,0x7C,0x00,0x00,0x00,0x1E,0x00,0x3E,0x00,0x00,0x00,0x7C,0x80,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0x80,0x7F,  // 112
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x00,0x00,0x7C,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x00,0x0E,0x00,0x1E,0x00,0x00,0x00,0x0E,0x80,0x0F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,  // 113
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xFE,0x01,  // 114
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xE0,0x01,0x78,0x00,0x00,0x00,0xF8,0x07,0x78,0x00,0x00,0x00,0xF8,0x07,0x70,0x00,0x00,0x00,0xFC,0x0F,0xF0,0x00,0x00,0x00,0x3C,0x1F,0xF0,0x00,0x00,0x00,0x1E,0x1E,0xE0,0x00,0x00,0x00,0x0E,0x1E,0xE0,0x00,0x00,0x00,0x0E,0x3C,0xE0,0x00,0x00,0x00,0x0E,0x3C,0xE0,0x00,0x00,0x00,0x0E,0x38,0xE0,0x00,0x00,0x00,0x0E,0x78,0xE0,0x00,0x00,0x00,0x0E,0x78,0xE0,0x00,0x00,0x00,0x0E,0xF0,0xF0,0x00,0x00,0x00,0x0E,0xF0,0x79,0x00,0x00,0x00,0x1C,0xE0,0x7F,0x00,0x00,0x00,0x1C,0xE0,0x3F,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x80,0x0F, // 115
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0xFF,0x7F,0x00,0x00,0x00,0x1C,0x00,0x7C,0x00,0x00,0x00,0x1C,0x00,0xF0,0x00,0x00,0x00,0x1C,0x00,0xF0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78, // 116
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF, // 117
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x06, // 118
-  0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x00,0xFE,0x03,  // 119
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x00,0x00,0x06,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x3E,0x00,0xFC,0x00,0x00,0x00,0x7E,0x00,0xFE,0x00,0x00,0x00,0xFC,0x81,0x3F,0x00,0x00,0x00,0xF8,0xC3,0x1F,0x00,0x00,0x00,0xE0,0xF7,0x07,0x00,0x00,0x00,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0x00,0xE0,0xFF,0x03,0x00,0x00,0x00,0xF0,0xE3,0x07,0x00,0x00,0x00,0xFC,0xC1,0x1F,0x00,0x00,0x00,0xFE,0x00,0x3F,0x00,0x00,0x00,0x3E,0x00,0xFE,0x00,0x00,0x00,0x1E,0x00,0xF8,0x00,0x00,0x00,0x06,0x00,0xF0,0x00,0x00,0x00,0x02,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x80, // 120
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x10,0x00,0x00,0x00,0xFE,0x03,0x18,0x00,0x00,0x00,0xF8,0x0F,0x1C,0x00,0x00,0x00,0xE0,0x3F,0x1F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x0E, // 121
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xF8,0x00,0x00,0x00,0x0E,0x00,0xFC,0x00,0x00,0x00,0x0E,0x00,0xFE,0x00,0x00,0x00,0x0E,0x00,0xFF,0x00,0x00,0x00,0x0E,0x80,0xEF,0x00,0x00,0x00,0x0E,0xC0,0xE7,0x00,0x00,0x00,0x0E,0xE0,0xE3,0x00,0x00,0x00,0x0E,0xF8,0xE1,0x00,0x00,0x00,0x0E,0xFC,0xE0,0x00,0x00,0x00,0x0E,0x7E,0xE0,0x00,0x00,0x00,0x0E,0x3F,0xE0,0x00,0x00,0x00,0x8E,0x0F,0xE0,0x00,0x00,0x00,0xCE,0x07,0xE0,0x00,0x00,0x00,0xEE,0x03,0xE0,0x00,0x00,0x00,0xFE,0x01,0xE0,0x00,0x00,0x00,0xFE,0x00,0xE0,0x00,0x00,0x00,0x7E,0x00,0xE0,0x00,0x00,0x00,0x3E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0, // 122
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xFC,0x80,0x7B,0xE0,0x0F,0x00,0xFF,0xFF,0xFB,0xFF,0x1F,0x80,0xFF,0xFF,0xF1,0xFF,0x1F,0x80,0xFF,0xFF,0xE0,0xFF,0x1F,0xC0,0x03,0x7E,0xC0,0x0F,0x10,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,  // 123
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0xFF,0xFF,0x01,  // 124
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x03,0x7E,0xC0,0x1F,0x10,0x80,0xFF,0xFF,0xE0,0xFF,0x1F,0x80,0xFF,0xFF,0xF1,0xFF,0x1F,0x00,0xFF,0xFF,0xFB,0xFF,0x1F,0x00,0xFC,0x80,0x7F,0xE0,0x0F,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,  // 125
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x0E,  // 126
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0xC0,0x1F,0x00,0x00,0x7E,0xF8,0xFF,0x1F,0x00,0x00,0x7E,0xF8,0xFF,0x1F,0x00,0x00,0x7E,0xF8,0xFF,0x1F,0x00,0x00,0x7E,0xF8,0xFF,0x1F,0x00,0x00,0x3C,0x00,0xC0,0x1F,  // 161
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xC0,0x1F,0xF8,0x03,0x00,0x00,0xC0,0x03,0xC0,0x03,0x00,0x00,0xE0,0x01,0x80,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xF0,0x00,0x00,0x0F,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0xE0,0xFF,0xFF,0xFF,0xFF,0x07,0xE0,0xFF,0xFF,0xFF,0xFF,0x07,0xE0,0xFF,0xFF,0xFF,0xFF,0x07,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0xE0,0x00,0x00,0x0F,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x01,0x80,0x07, // 162
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xF0,0x00,0x00,0x00,0xE0,0x00,0xF0,0x00,0x00,0x00,0xE0,0x00,0xFE,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x00,0xF8,0xFF,0xFF,0xEF,0x00,0x00,0xFE,0xFF,0xFF,0xE7,0x00,0x00,0xFE,0xFF,0xFF,0xE1,0x00,0x00,0x1F,0xE0,0x00,0xE0,0x00,0x80,0x07,0xE0,0x00,0xE0,0x00,0x80,0x07,0xE0,0x00,0xE0,0x00,0x80,0x03,0xE0,0x00,0xE0,0x00,0x80,0x03,0xE0,0x00,0xE0,0x00,0x80,0x03,0xE0,0x00,0xE0,0x00,0x80,0x03,0xE0,0x00,0xE0,0x00,0x80,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x0F,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0, // 163
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x06,0x00,0x00,0xF0,0xE0,0x07,0x0F,0x00,0x00,0xE0,0xF9,0x9F,0x07,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0x80,0x3F,0xF8,0x03,0x00,0x00,0x00,0x0F,0xE0,0x01,0x00,0x00,0x00,0x07,0xC0,0x01,0x00,0x00,0x80,0x07,0xC0,0x03,0x00,0x00,0x80,0x03,0x80,0x03,0x00,0x00,0x80,0x03,0x80,0x03,0x00,0x00,0x80,0x03,0x80,0x03,0x00,0x00,0x80,0x03,0x80,0x03,0x00,0x00,0x80,0x03,0x80,0x03,0x00,0x00,0x80,0x07,0xC0,0x03,0x00,0x00,0x00,0x07,0xC0,0x01,0x00,0x00,0x00,0x0F,0xE0,0x01,0x00,0x00,0x80,0x3F,0xF8,0x03,0x00,0x00,0xC0,0xFF,0xFF,0x03,0x00,0x00,0xE0,0xF9,0x9F,0x07,0x00,0x00,0xF0,0xE0,0x07,0x0F,0x00,0x00,0x60,0x00,0x00,0x06, // 164
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x0E,0x07,0x00,0x00,0x7F,0x00,0x0E,0x07,0x00,0x00,0xFE,0x01,0x0E,0x07,0x00,0x00,0xF8,0x07,0x0E,0x07,0x00,0x00,0xE0,0x1F,0x0E,0x07,0x00,0x00,0xC0,0x3F,0x0E,0x07,0x00,0x00,0x00,0xFF,0x0E,0x07,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x00,0x00,0x00,0xFC,0x0E,0x07,0x00,0x00,0x00,0x3F,0x0E,0x07,0x00,0x00,0x80,0x1F,0x0E,0x07,0x00,0x00,0xE0,0x07,0x0E,0x07,0x00,0x00,0xF8,0x01,0x0E,0x07,0x00,0x00,0x7E,0x00,0x0E,0x07,0x00,0x00,0x1F,0x00,0x0E,0x07,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x03,  // 165
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x3F,0xFC,0xFF,0x01,0x80,0xFF,0x3F,0xFC,0xFF,0x01,0x80,0xFF,0x3F,0xFC,0xFF,0x01,  // 166
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x1F,0x00,0x18,0x00,0xF8,0xC7,0x3F,0x00,0x10,0x00,0xFE,0xEF,0x7F,0x00,0x10,0x00,0xFE,0xFF,0xFF,0x00,0x10,0x00,0x0F,0x7F,0xF8,0x01,0x10,0x00,0x07,0x1E,0xE0,0x03,0x00,0x80,0x07,0x3C,0xE0,0x03,0x00,0x80,0x03,0x7C,0xC0,0x07,0x00,0x80,0x03,0x78,0x80,0x07,0x00,0x80,0x03,0xF8,0x80,0x0F,0x00,0x80,0x03,0xF0,0x00,0x1F,0x00,0x80,0x03,0xE0,0x01,0x1E,0x00,0x80,0x03,0xE0,0x03,0x3E,0x10,0x80,0x07,0xC0,0x07,0x3C,0x10,0x80,0x07,0xC0,0x0F,0x7E,0x18,0x00,0x07,0x80,0xFF,0xFF,0x1F,0x00,0x0F,0x00,0xFF,0xF7,0x1F,0x00,0x00,0x00,0xFE,0xE3,0x0F,0x00,0x00,0x00,0xF8,0xC0,0x07,  // 167
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x18,  // 168
-  0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x00,0xF0,0x07,0xF0,0x07,0x00,0x00,0xFC,0x00,0x80,0x1F,0x00,0x00,0x3E,0xF0,0x0F,0x3E,0x00,0x00,0x1E,0xFC,0x3F,0x3C,0x00,0x00,0x0F,0xFF,0xFF,0x78,0x00,0x00,0x87,0x0F,0xF8,0x71,0x00,0x80,0xC7,0x03,0xE0,0xF1,0x00,0x80,0xC3,0x01,0xC0,0xE3,0x00,0x80,0xE3,0x01,0x80,0xE3,0x00,0x80,0xE3,0x00,0x00,0xE7,0x00,0x80,0xE3,0x00,0x00,0xE7,0x00,0x80,0xE3,0x00,0x00,0xE7,0x00,0x80,0xE7,0x00,0x00,0xF7,0x00,0x00,0xE7,0x00,0x00,0x77,0x00,0x00,0xEF,0x00,0x00,0x7F,0x00,0x00,0xDE,0x01,0x80,0x3F,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0xFC,0x00,0x80,0x1F,0x00,0x00,0xF0,0x07,0xF0,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x00,0xF8,0x0F,  // 169
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x1E,0x3C,0x00,0x00,0x00,0x00,0x0F,0x38,0x00,0x00,0x00,0x00,0x07,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x00,0x80,0x03,0x0E,0x00,0x00,0x00,0x80,0x03,0x0F,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x20, // 170
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xEF,0x0F,0x00,0x00,0x00,0xF8,0xC7,0x3F,0x00,0x00,0x00,0xFC,0x01,0x7F,0x00,0x00,0x00,0xF8,0x00,0x3E,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xEF,0x0F,0x00,0x00,0x00,0xF8,0xC7,0x3F,0x00,0x00,0x00,0xFC,0x01,0x7F,0x00,0x00,0x00,0xF8,0x00,0x3E,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0x10,0x00,0x10, // 171
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x00,0xF8,0x1F, // 172
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x1C,  // 173
-  0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x00,0xF0,0x07,0xF0,0x07,0x00,0x00,0xFC,0x00,0x80,0x1F,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x78,0x00,0x00,0x87,0xFF,0xFF,0x73,0x00,0x80,0x87,0xFF,0xFF,0xF3,0x00,0x80,0x83,0xFF,0xFF,0xE3,0x00,0x80,0x83,0x81,0x07,0xE0,0x00,0x80,0x83,0x81,0x1F,0xE0,0x00,0x80,0x83,0xC3,0x7F,0xE0,0x00,0x80,0x83,0xFF,0xFC,0xE1,0x00,0x80,0x07,0x7F,0xE0,0xF3,0x00,0x00,0x07,0x1E,0x80,0x73,0x00,0x00,0x0F,0x00,0x00,0x7A,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0xFC,0x00,0x80,0x1F,0x00,0x00,0xF0,0x07,0xF0,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0x00,0xF8,0x0F,  // 174
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x38,  // 175
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x80,0x01,0x03,0x00,0x00,0x00,0x80,0x01,0x03,0x00,0x00,0x00,0x80,0x01,0x03,0x00,0x00,0x00,0x80,0x83,0x03,0x00,0x00,0x00,0x00,0xC7,0x01,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,  // 176
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0xF8,0xFF,0xFF,0xE3,0x00,0x00,0xF8,0xFF,0xFF,0xE3,0x00,0x00,0xF8,0xFF,0xFF,0xE3,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0xE0,0x00,0xE0, // 177
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x07,0xC0,0x07,0x00,0x00,0x00,0x07,0xE0,0x07,0x00,0x00,0x80,0x03,0x70,0x07,0x00,0x00,0x80,0x03,0x38,0x07,0x00,0x00,0x80,0x03,0x1C,0x07,0x00,0x00,0x80,0x03,0x0C,0x07,0x00,0x00,0x80,0x03,0x06,0x07,0x00,0x00,0x80,0x03,0x07,0x07,0x00,0x00,0x80,0x83,0x03,0x07,0x00,0x00,0x80,0xC3,0x01,0x07,0x00,0x00,0x80,0xE7,0x00,0x07,0x00,0x00,0x00,0xFF,0x00,0x07,0x00,0x00,0x00,0x7F,0x00,0x07,0x00,0x00,0x00,0x1E,0x00,0x07,  // 178
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x07,0x80,0x03,0x00,0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x80,0x83,0x03,0x07,0x00,0x00,0x80,0x83,0x03,0x07,0x00,0x00,0x80,0x83,0x03,0x07,0x00,0x00,0x80,0x83,0x03,0x07,0x00,0x00,0x80,0x83,0x03,0x07,0x00,0x00,0x80,0x83,0x03,0x07,0x00,0x00,0x80,0xC3,0x03,0x07,0x00,0x00,0x80,0xC7,0x87,0x03,0x00,0x00,0x00,0xE7,0x87,0x03,0x00,0x00,0x00,0xFF,0xCF,0x03,0x00,0x00,0x00,0x7E,0xFE,0x01,0x00,0x00,0x00,0x1C,0xFE,0x00,0x00,0x00,0x00,0x00,0x78, // 179
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x80, // 180
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF, // 181
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,  // 182
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x38,  // 183
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x10,  // 184
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x00,0x38,0x00,0x07,0x00,0x00,0x00,0x3C,0x00,0x07,0x00,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x00,0x0F,0x00,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,  // 185
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0x0F,0x1E,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x80,0x07,0x3C,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x80,0x07,0x3C,0x00,0x00,0x00,0x00,0x07,0x1C,0x00,0x00,0x00,0x00,0x0F,0x1E,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x01, // 186
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0xF8,0x00,0x3E,0x00,0x00,0x00,0xFC,0x01,0x7F,0x00,0x00,0x00,0xF8,0xC7,0x3F,0x00,0x00,0x00,0xE0,0xEF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x78,0x00,0x3C,0x00,0x00,0x00,0xF8,0x00,0x3E,0x00,0x00,0x00,0xFC,0x01,0x7F,0x00,0x00,0x00,0xF8,0xC7,0x3F,0x00,0x00,0x00,0xE0,0xEF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x7C,  // 187
-  0x00,0x78,0xE0,0x00,0x80,0x00,0x00,0x3C,0xE0,0x00,0xE0,0x00,0x00,0x1E,0xE0,0x00,0xF0,0x00,0x00,0x0F,0xE0,0x00,0x7C,0x00,0x00,0xFF,0xFF,0x00,0x3E,0x00,0x00,0xFF,0xFF,0x80,0x0F,0x00,0x00,0xFF,0xFF,0xE0,0x07,0x00,0x00,0x00,0xE0,0xF0,0x01,0x00,0x00,0x00,0xE0,0xFC,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x80,0x1F,0x1E,0x00,0x00,0x00,0xC0,0x07,0x1F,0x00,0x00,0x00,0xF0,0x83,0x1F,0x00,0x00,0x00,0xF8,0xC0,0x1F,0x00,0x00,0x00,0x3E,0xF0,0x1D,0x00,0x00,0x00,0x1F,0xF8,0x1C,0x00,0x00,0xC0,0x07,0x3C,0x1C,0x00,0x00,0xE0,0x03,0x1E,0x1C,0x00,0x00,0xF8,0x00,0xFF,0xFF,0x00,0x00,0x7C,0x00,0xFF,0xFF,0x00,0x00,0x1F,0x00,0xFF,0xFF,0x00,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x03,0x00,0x00,0x1C,0x00,0x00,0x01,0x00,0x00,0x1C, // 188
-  0x00,0x3C,0xE0,0x00,0x80,0x00,0x00,0x1E,0xE0,0x00,0xC0,0x00,0x00,0x0E,0xE0,0x00,0xF0,0x00,0x00,0x07,0xE0,0x00,0xF8,0x00,0x00,0xFF,0xFF,0x00,0x3E,0x00,0x00,0xFF,0xFF,0x80,0x1F,0x00,0x00,0xFF,0xFF,0xC0,0x07,0x00,0x00,0x00,0xE0,0xF0,0x03,0x00,0x00,0x00,0xE0,0xF8,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x00,0xE0,0x03,0xF0,0x00,0x00,0x00,0xF8,0x0E,0xF8,0x00,0x00,0x00,0x7E,0x0E,0xFC,0x00,0x00,0x00,0x1F,0x07,0xEE,0x00,0x00,0xC0,0x0F,0x07,0xE7,0x00,0x00,0xE0,0x03,0x07,0xE3,0x00,0x00,0xF8,0x01,0x87,0xE1,0x00,0x00,0x7C,0x00,0xCF,0xE1,0x00,0x00,0x1F,0x00,0xFE,0xE0,0x00,0x00,0x0F,0x00,0x7E,0xE0,0x00,0x00,0x03,0x00,0x3C,0xE0,0x00,0x00,0x01,  // 189
-  0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x0E,0x70,0x00,0xF0,0x00,0x00,0x87,0xE3,0x00,0x7C,0x00,0x00,0x87,0xE3,0x00,0x3E,0x00,0x00,0x87,0xE3,0x80,0x0F,0x00,0x00,0x87,0xE3,0xC0,0x07,0x00,0x00,0xCF,0xE3,0xF0,0x01,0x00,0x00,0xFF,0xF7,0xF8,0x00,0x00,0x00,0xFE,0x7E,0x7C,0x00,0x00,0x00,0x3C,0x7E,0x1F,0x00,0x00,0x00,0x00,0x9C,0x0F,0x1E,0x00,0x00,0x00,0xE0,0x03,0x1F,0x00,0x00,0x00,0xF0,0x81,0x1F,0x00,0x00,0x00,0x7C,0xC0,0x1F,0x00,0x00,0x00,0x3E,0xF0,0x1D,0x00,0x00,0x80,0x0F,0xF8,0x1C,0x00,0x00,0xC0,0x07,0x3C,0x1C,0x00,0x00,0xF0,0x01,0x1E,0x1C,0x00,0x00,0xF8,0x00,0xFF,0xFF,0x00,0x00,0x7C,0x00,0xFF,0xFF,0x00,0x00,0x1F,0x00,0xFF,0xFF,0x00,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x03,0x00,0x00,0x1C,0x00,0x00,0x01,0x00,0x00,0x1C, // 190
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xF8,0x11,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x3C,0x80,0x0F,0x00,0x00,0x00,0x7E,0xF8,0x07,0x00,0x00,0x00,0x7E,0xF8,0x03,0x00,0x00,0x00,0x7E,0xF8,0x01,0x00,0x00,0x00,0x7E,0x78,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x10,  // 191
-  0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0xCF,0x01,0x00,0x00,0xFE,0xFF,0xC0,0x01,0x00,0x01,0xFF,0x0F,0xC0,0x01,0x00,0x01,0xFF,0x00,0xC0,0x01,0x00,0x03,0xFF,0x01,0xC0,0x01,0x00,0x07,0xFF,0x0F,0xC0,0x01,0x00,0x0E,0xFE,0xFF,0xC0,0x01,0x00,0x1C,0xF0,0xFF,0xCF,0x01,0x00,0x18,0x00,0xFF,0xFF,0x01,0x00,0x10,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xC0, // 192
-  0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0xF0,0xFF,0xCF,0x01,0x00,0x10,0xFE,0xFF,0xC0,0x01,0x00,0x18,0xFF,0x0F,0xC0,0x01,0x00,0x1C,0xFF,0x00,0xC0,0x01,0x00,0x0E,0xFF,0x01,0xC0,0x01,0x00,0x0F,0xFF,0x0F,0xC0,0x01,0x00,0x07,0xFE,0xFF,0xC0,0x01,0x00,0x03,0xF0,0xFF,0xCF,0x01,0x00,0x01,0x00,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xC0, // 193
-  0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x07,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x10,0xF0,0xFF,0xCF,0x01,0x00,0x1C,0xFE,0xFF,0xC0,0x01,0x00,0x1E,0xFF,0x0F,0xC0,0x01,0x00,0x0F,0xFF,0x00,0xC0,0x01,0x00,0x07,0xFF,0x01,0xC0,0x01,0x00,0x03,0xFF,0x0F,0xC0,0x01,0x00,0x07,0xFE,0xFF,0xC0,0x01,0x00,0x0F,0xF0,0xFF,0xCF,0x01,0x00,0x1E,0x00,0xFF,0xFF,0x01,0x00,0x1C,0x00,0xF0,0xFF,0x07,0x00,0x10,0x00,0x80,0xFF,0x7F,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xC0, // 194
-  0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x18,0x00,0xF0,0xFF,0x07,0x00,0x1C,0x00,0xFF,0xFF,0x01,0x00,0x1E,0xF0,0xFF,0xCF,0x01,0x00,0x06,0xFE,0xFF,0xC0,0x01,0x00,0x06,0xFF,0x0F,0xC0,0x01,0x00,0x06,0xFF,0x00,0xC0,0x01,0x00,0x0C,0xFF,0x01,0xC0,0x01,0x00,0x0C,0xFF,0x0F,0xC0,0x01,0x00,0x18,0xFE,0xFF,0xC0,0x01,0x00,0x18,0xF0,0xFF,0xCF,0x01,0x00,0x18,0x00,0xFF,0xFF,0x01,0x00,0x1E,0x00,0xF0,0xFF,0x07,0x00,0x0E,0x00,0x80,0xFF,0x7F,0x00,0x0E,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xC0, // 195
-  0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x80,0xFF,0x7F,0x00,0x0C,0x00,0xF0,0xFF,0x07,0x00,0x1E,0x00,0xFF,0xFF,0x01,0x00,0x1E,0xF0,0xFF,0xCF,0x01,0x00,0x0C,0xFE,0xFF,0xC0,0x01,0x00,0x00,0xFF,0x0F,0xC0,0x01,0x00,0x00,0xFF,0x00,0xC0,0x01,0x00,0x00,0xFF,0x01,0xC0,0x01,0x00,0x00,0xFF,0x0F,0xC0,0x01,0x00,0x00,0xFE,0xFF,0xC0,0x01,0x00,0x00,0xF0,0xFF,0xCF,0x01,0x00,0x0C,0x00,0xFF,0xFF,0x01,0x00,0x1E,0x00,0xF0,0xFF,0x07,0x00,0x1E,0x00,0x80,0xFF,0x7F,0x00,0x0C,0x00,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xC0, // 196
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0xF0,0xF8,0xFF,0xC3,0x01,0x00,0xF8,0xFF,0x7F,0xC0,0x01,0x00,0x9C,0xFF,0x07,0xC0,0x01,0x00,0x0C,0x7F,0x00,0xC0,0x01,0x00,0x9C,0xFF,0x07,0xC0,0x01,0x00,0xF8,0xFF,0x7F,0xC0,0x01,0x00,0xF0,0xF8,0xFF,0xC3,0x01,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFC,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0xF0, // 197
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0xFE,0xFF,0x00,0x00,0x00,0xC0,0xFF,0xE3,0x00,0x00,0x00,0xF0,0x7F,0xE0,0x00,0x00,0x00,0xFE,0x1F,0xE0,0x00,0x00,0x00,0xFF,0x03,0xE0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0, // 198
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0x00,0x00,0xC0,0xFF,0xFF,0x07,0x00,0x00,0xE0,0xFF,0xFF,0x0F,0x00,0x00,0xF8,0x0F,0xF0,0x1F,0x00,0x00,0xF8,0x01,0x80,0x3F,0x00,0x00,0x7C,0x00,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0xF0,0x06,0x00,0x07,0x00,0x00,0xE0,0x07,0x00,0x07,0x00,0x00,0xE0,0x0D,0x00,0x07,0x00,0x00,0xE0,0x1C,0x00,0x07,0x00,0x00,0xE0,0x1C,0x00,0x07,0x00,0x00,0xE0,0x18,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0x70, // 199
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x01,0x07,0xC0,0x01,0xE0,0x00,0x03,0x07,0xC0,0x01,0xE0,0x00,0x07,0x07,0xC0,0x01,0xE0,0x00,0x0E,0x07,0xC0,0x01,0xE0,0x00,0x1C,0x07,0xC0,0x01,0xE0,0x00,0x18,0x07,0xC0,0x01,0xE0,0x00,0x10,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 200
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x10,0x07,0xC0,0x01,0xE0,0x00,0x18,0x07,0xC0,0x01,0xE0,0x00,0x1C,0x07,0xC0,0x01,0xE0,0x00,0x0E,0x07,0xC0,0x01,0xE0,0x00,0x07,0x07,0xC0,0x01,0xE0,0x00,0x03,0x07,0xC0,0x01,0xE0,0x00,0x01,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 201
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x10,0xFF,0xFF,0xFF,0xFF,0x00,0x1C,0x07,0xC0,0x01,0xE0,0x00,0x1E,0x07,0xC0,0x01,0xE0,0x00,0x0F,0x07,0xC0,0x01,0xE0,0x00,0x07,0x07,0xC0,0x01,0xE0,0x00,0x03,0x07,0xC0,0x01,0xE0,0x00,0x07,0x07,0xC0,0x01,0xE0,0x00,0x0F,0x07,0xC0,0x01,0xE0,0x00,0x1E,0x07,0xC0,0x01,0xE0,0x00,0x1C,0x07,0xC0,0x01,0xE0,0x00,0x10,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 202
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x0C,0xFF,0xFF,0xFF,0xFF,0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0x00,0x1C,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x0C,0x07,0xC0,0x01,0xE0,0x00,0x1E,0x07,0xC0,0x01,0xE0,0x00,0x1E,0x07,0xC0,0x01,0xE0,0x00,0x1C,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 203
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0x00,0x0E,0xFF,0xFF,0xFF,0xFF,0x00,0x1C,0x07,0x00,0x00,0xE0,0x00,0x18,0x07,0x00,0x00,0xE0,0x00,0x10,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 204
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x10,0x07,0x00,0x00,0xE0,0x00,0x18,0x07,0x00,0x00,0xE0,0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0x00,0x0E,0xFF,0xFF,0xFF,0xFF,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0x00,0x03,0x07,0x00,0x00,0xE0,0x00,0x01,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 205
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x10,0x07,0x00,0x00,0xE0,0x00,0x1C,0x07,0x00,0x00,0xE0,0x00,0x1E,0x07,0x00,0x00,0xE0,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0x00,0x0F,0x07,0x00,0x00,0xE0,0x00,0x1E,0x07,0x00,0x00,0xE0,0x00,0x1C,0x07,0x00,0x00,0xE0,0x00,0x10,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 206
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x0C,0x07,0x00,0x00,0xE0,0x00,0x1E,0x07,0x00,0x00,0xE0,0x00,0x1E,0x07,0x00,0x00,0xE0,0x00,0x0C,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x0C,0x07,0x00,0x00,0xE0,0x00,0x1E,0x07,0x00,0x00,0xE0,0x00,0x1E,0x07,0x00,0x00,0xE0,0x00,0x0C,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0, // 207
-  0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0xC0,0x01,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x0F,0x00,0x00,0xF0,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0xFC,0x03,0xC0,0x3F,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0x00,0xF8,0x1F,  // 208
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x18,0xFF,0xFF,0xFF,0xFF,0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0x00,0x1E,0xFE,0x03,0x00,0x00,0x00,0x06,0xF8,0x0F,0x00,0x00,0x00,0x06,0xE0,0x3F,0x00,0x00,0x00,0x06,0x80,0xFF,0x00,0x00,0x00,0x0C,0x00,0xFE,0x03,0x00,0x00,0x0C,0x00,0xF8,0x0F,0x00,0x00,0x18,0x00,0xE0,0x7F,0x00,0x00,0x18,0x00,0x80,0xFF,0x01,0x00,0x18,0x00,0x00,0xFC,0x07,0x00,0x1E,0x00,0x00,0xF0,0x1F,0x00,0x0E,0x00,0x00,0xC0,0x7F,0x00,0x0E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF, // 209
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF0,0x00,0x01,0x07,0x00,0x00,0xE0,0x00,0x03,0x07,0x00,0x00,0xE0,0x00,0x07,0x07,0x00,0x00,0xE0,0x00,0x0E,0x07,0x00,0x00,0xE0,0x00,0x1C,0x07,0x00,0x00,0xE0,0x00,0x18,0x0F,0x00,0x00,0xF0,0x00,0x10,0x1E,0x00,0x00,0x78,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,  // 210
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x10,0x1E,0x00,0x00,0x78,0x00,0x18,0x0F,0x00,0x00,0xF0,0x00,0x1C,0x07,0x00,0x00,0xE0,0x00,0x0E,0x07,0x00,0x00,0xE0,0x00,0x0F,0x07,0x00,0x00,0xE0,0x00,0x07,0x07,0x00,0x00,0xE0,0x00,0x03,0x07,0x00,0x00,0xE0,0x00,0x01,0x0F,0x00,0x00,0xF0,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,  // 211
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x10,0x3E,0x00,0x00,0x7C,0x00,0x1C,0x1E,0x00,0x00,0x78,0x00,0x1E,0x0F,0x00,0x00,0xF0,0x00,0x0F,0x07,0x00,0x00,0xE0,0x00,0x07,0x07,0x00,0x00,0xE0,0x00,0x03,0x07,0x00,0x00,0xE0,0x00,0x07,0x07,0x00,0x00,0xE0,0x00,0x0F,0x07,0x00,0x00,0xE0,0x00,0x1E,0x0F,0x00,0x00,0xF0,0x00,0x1C,0x1E,0x00,0x00,0x78,0x00,0x10,0x3E,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,  // 212
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x18,0xF8,0x03,0xC0,0x1F,0x00,0x1C,0x7C,0x00,0x00,0x3E,0x00,0x1E,0x3E,0x00,0x00,0x7C,0x00,0x06,0x1E,0x00,0x00,0x78,0x00,0x06,0x0F,0x00,0x00,0xF0,0x00,0x0E,0x07,0x00,0x00,0xE0,0x00,0x0C,0x07,0x00,0x00,0xE0,0x00,0x1C,0x07,0x00,0x00,0xE0,0x00,0x18,0x07,0x00,0x00,0xE0,0x00,0x18,0x07,0x00,0x00,0xE0,0x00,0x18,0x0F,0x00,0x00,0xF0,0x00,0x1E,0x1E,0x00,0x00,0x78,0x00,0x0E,0x3E,0x00,0x00,0x7C,0x00,0x06,0x7C,0x00,0x00,0x3E,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,  // 213
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x0C,0xF8,0x03,0xC0,0x1F,0x00,0x1E,0x7C,0x00,0x00,0x3E,0x00,0x1E,0x3E,0x00,0x00,0x7C,0x00,0x0C,0x1E,0x00,0x00,0x78,0x00,0x00,0x0F,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x0C,0x0F,0x00,0x00,0xF0,0x00,0x1E,0x1E,0x00,0x00,0x78,0x00,0x1E,0x3E,0x00,0x00,0x7C,0x00,0x0C,0x7C,0x00,0x00,0x3E,0x00,0x00,0xF8,0x03,0xC0,0x1F,0x00,0x00,0xF0,0xFF,0xFF,0x0F,0x00,0x00,0xE0,0xFF,0xFF,0x07,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0x00,0x00,0xFC,0x3F,  // 214
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x60,0x00,0x00,0x00,0x3C,0x00,0xF0,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0xF0,0x00,0x3C,0x00,0x00,0x00,0xE0,0x01,0x1E,0x00,0x00,0x00,0xC0,0x03,0x0F,0x00,0x00,0x00,0x80,0x87,0x07,0x00,0x00,0x00,0x00,0xCF,0x03,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xCF,0x03,0x00,0x00,0x00,0x80,0x87,0x07,0x00,0x00,0x00,0xC0,0x03,0x0F,0x00,0x00,0x00,0xE0,0x01,0x1E,0x00,0x00,0x00,0xF0,0x00,0x3C,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x3C,0x00,0xF0,0x00,0x00,0x00,0x18,0x00,0x60, // 215
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x01,0x00,0x80,0xFF,0xFF,0xC1,0x01,0x00,0xE0,0xFF,0xFF,0xF7,0x01,0x00,0xF8,0xFF,0xFF,0xFF,0x01,0x00,0xFC,0x03,0x80,0xFF,0x01,0x00,0x7C,0x00,0x80,0x7F,0x00,0x00,0x1E,0x00,0xE0,0x7F,0x00,0x00,0x0E,0x00,0xF8,0x7F,0x00,0x00,0x0F,0x00,0xFE,0xF3,0x00,0x00,0x07,0x00,0xFF,0xE0,0x00,0x00,0x07,0xC0,0x3F,0xE0,0x00,0x00,0x07,0xF0,0x0F,0xE0,0x00,0x00,0x07,0xFC,0x03,0xE0,0x00,0x00,0x07,0xFF,0x00,0xE0,0x00,0x00,0xCF,0x7F,0x00,0xF0,0x00,0x00,0xFE,0x1F,0x00,0x70,0x00,0x00,0xFE,0x07,0x00,0x7C,0x00,0x00,0xFE,0x01,0x00,0x7F,0x00,0x80,0xFF,0x01,0xE0,0x3F,0x00,0x80,0xFF,0xFF,0xFF,0x1F,0x00,0x80,0xEF,0xFF,0xFF,0x07,0x00,0x80,0x83,0xFF,0xFF,0x01,0x00,0x80,0x00,0xFC,0x3F,  // 216
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x03,0x00,0x00,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x01,0x00,0x00,0x00,0xE0,0x00,0x03,0x00,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xE0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x18,0x00,0x00,0x00,0xF0,0x00,0x10,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xFF,0xFF,0xFF,0x01, // 217
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x03,0x00,0x00,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x10,0x00,0x00,0x00,0x78,0x00,0x18,0x00,0x00,0x00,0xF0,0x00,0x1C,0x00,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0x00,0xE0,0x00,0x0F,0x00,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x00,0xE0,0x00,0x03,0x00,0x00,0x00,0xE0,0x00,0x01,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xFF,0xFF,0xFF,0x01, // 218
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x03,0x00,0x00,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x10,0x00,0x00,0x00,0x7C,0x00,0x1C,0x00,0x00,0x00,0x78,0x00,0x1E,0x00,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x00,0xE0,0x00,0x03,0x00,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x00,0xE0,0x00,0x0F,0x00,0x00,0x00,0xE0,0x00,0x1E,0x00,0x00,0x00,0xF0,0x00,0x1C,0x00,0x00,0x00,0x78,0x00,0x10,0x00,0x00,0x00,0x7E,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xFF,0xFF,0xFF,0x01, // 219
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x03,0x00,0x00,0xFF,0xFF,0xFF,0x0F,0x00,0x0C,0xFF,0xFF,0xFF,0x3F,0x00,0x1E,0xFF,0xFF,0xFF,0x3F,0x00,0x1E,0x00,0x00,0x00,0x7C,0x00,0x0C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x0C,0x00,0x00,0x00,0xF0,0x00,0x1E,0x00,0x00,0x00,0x78,0x00,0x1E,0x00,0x00,0x00,0x7E,0x00,0x0C,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0xFF,0x07,0x00,0x00,0xFF,0xFF,0xFF,0x01, // 220
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x10,0xC0,0x3F,0x00,0x00,0x00,0x18,0x00,0xFF,0x00,0x00,0x00,0x1C,0x00,0xFC,0xFF,0xFF,0x00,0x0E,0x00,0xF0,0xFF,0xFF,0x00,0x0F,0x00,0xF0,0xFF,0xFF,0x00,0x07,0x00,0xFC,0xFF,0xFF,0x00,0x03,0x00,0xFF,0x00,0x00,0x00,0x01,0xC0,0x3F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x03,  // 221
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xC0,0x01,0x80,0x03,0x00,0x00,0xC0,0x01,0xC0,0x01,0x00,0x00,0xC0,0x03,0xC0,0x01,0x00,0x00,0x80,0x03,0xE0,0x01,0x00,0x00,0x80,0x07,0xF0,0x00,0x00,0x00,0x80,0x0F,0xFC,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0x00,0xF0,0x03,  // 222
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0xC0,0x03,0x70,0x00,0x00,0x00,0xC0,0x01,0xFC,0x01,0xF0,0x00,0xC0,0x01,0xFE,0x03,0xF0,0x00,0xC0,0x01,0xFF,0x03,0xE0,0x00,0xC0,0x81,0xCF,0x07,0xE0,0x00,0xC0,0xC3,0x87,0x0F,0xE0,0x00,0xC0,0xE3,0x03,0x0F,0xE0,0x00,0x80,0xFF,0x01,0x1F,0xE0,0x00,0x80,0xFF,0x00,0x3E,0xE0,0x00,0x00,0x7F,0x00,0x7C,0xF0,0x00,0x00,0x3C,0x00,0xF8,0x78,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x80,0x0F, // 223
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x80,0x00,0x7C,0x00,0xF0,0x00,0x80,0x01,0x3C,0x00,0xE0,0x00,0x80,0x03,0x1E,0x00,0xE0,0x00,0x80,0x07,0x1E,0x00,0xE0,0x00,0x00,0x0F,0x0E,0x00,0x70,0x00,0x00,0x0E,0x0E,0x00,0x70,0x00,0x00,0x1C,0x0E,0x00,0x38,0x00,0x00,0x38,0x0E,0x00,0x3C,0x00,0x00,0x30,0x0E,0x00,0x1E,0x00,0x00,0x20,0x0E,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xC0, // 224
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x00,0x00,0x7C,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x20,0x1E,0x00,0xE0,0x00,0x00,0x30,0x0E,0x00,0x70,0x00,0x00,0x38,0x0E,0x00,0x70,0x00,0x00,0x1C,0x0E,0x00,0x38,0x00,0x00,0x0E,0x0E,0x00,0x3C,0x00,0x00,0x07,0x0E,0x00,0x1E,0x00,0x80,0x03,0x0E,0x80,0x07,0x00,0x80,0x01,0xFE,0xFF,0x3F,0x00,0x80,0x01,0xFE,0xFF,0xFF,0x00,0x80,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xC0, // 225
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x00,0x00,0x7C,0x00,0xF0,0x00,0x00,0x30,0x3C,0x00,0xE0,0x00,0x00,0x38,0x1E,0x00,0xE0,0x00,0x00,0x3C,0x1E,0x00,0xE0,0x00,0x00,0x1F,0x0E,0x00,0x70,0x00,0x80,0x0F,0x0E,0x00,0x70,0x00,0x80,0x07,0x0E,0x00,0x38,0x00,0x80,0x0F,0x0E,0x00,0x3C,0x00,0x00,0x1E,0x0E,0x00,0x1E,0x00,0x00,0x3C,0x0E,0x80,0x07,0x00,0x00,0x38,0xFE,0xFF,0x3F,0x00,0x00,0x20,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xC0, // 226
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x30,0xF0,0x03,0x7C,0x00,0x00,0x38,0xF8,0x00,0xF0,0x00,0x00,0x3C,0x7C,0x00,0xF0,0x00,0x00,0x0C,0x3C,0x00,0xE0,0x00,0x00,0x0C,0x1E,0x00,0xE0,0x00,0x00,0x1C,0x1E,0x00,0xE0,0x00,0x00,0x18,0x0E,0x00,0x70,0x00,0x00,0x18,0x0E,0x00,0x70,0x00,0x00,0x30,0x0E,0x00,0x38,0x00,0x00,0x30,0x0E,0x00,0x3C,0x00,0x00,0x30,0x0E,0x00,0x1E,0x00,0x00,0x3C,0x0E,0x80,0x07,0x00,0x00,0x1C,0xFE,0xFF,0x3F,0x00,0x00,0x0C,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xC0, // 227
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x18,0xF0,0x03,0x7C,0x00,0x00,0x3C,0xF8,0x00,0xF0,0x00,0x00,0x3C,0x7C,0x00,0xF0,0x00,0x00,0x18,0x3C,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x18,0x0E,0x00,0x1E,0x00,0x00,0x3C,0x0E,0x80,0x07,0x00,0x00,0x3C,0xFE,0xFF,0x3F,0x00,0x00,0x18,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xC0, // 228
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,0xC0,0xFF,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x7F,0x00,0x00,0x00,0xF0,0x03,0x7C,0x00,0x00,0x00,0xF8,0x00,0xF0,0x00,0x00,0x00,0x7C,0x00,0xF0,0x00,0x00,0x00,0x3C,0x00,0xE0,0x00,0x00,0x1E,0x1E,0x00,0xE0,0x00,0x00,0x3F,0x1E,0x00,0xE0,0x00,0x80,0x73,0x0E,0x00,0x70,0x00,0x80,0x61,0x0E,0x00,0x70,0x00,0x80,0x61,0x0E,0x00,0x38,0x00,0x80,0x73,0x0E,0x00,0x3C,0x00,0x00,0x3F,0x0E,0x00,0x1E,0x00,0x00,0x1E,0x0E,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xC0, // 229
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x3F,0x00,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x00,0xFC,0x03,0xF8,0x00,0x00,0x00,0x7C,0x00,0xE0,0x00,0x00,0x00,0x1E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x00,0x0E,0x00,0x1F,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x00,0xFC,0xFF,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0x00,0x00,0x1E,0x1C,0xF8,0x00,0x00,0x00,0x0E,0x1C,0xF0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x1E,0x1C,0xE0,0x00,0x00,0x00,0xFC,0x1F,0xE0,0x00,0x00,0x00,0xFC,0x1F,0xE0,0x00,0x00,0x00,0xF0,0x1F,0x60,0x00,0x00,0x00,0xC0,0x1F,0x60, // 230
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0x78,0x00,0x7C,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x1C,0x00,0xF0,0x00,0x00,0x00,0x1E,0x00,0xF0,0x0C,0x00,0x00,0x0E,0x00,0xE0,0x0F,0x00,0x00,0x0E,0x00,0xE0,0x1F,0x00,0x00,0x0E,0x00,0xE0,0x18,0x00,0x00,0x0E,0x00,0xE0,0x18,0x00,0x00,0x0E,0x00,0xE0,0x10,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x00,0x3C,0x00,0x78,0x00,0x00,0x00,0x78,0x00,0x3C, // 231
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x1D,0x3F,0x00,0x00,0x00,0x7C,0x1C,0x7C,0x00,0x80,0x00,0x3C,0x1C,0x78,0x00,0x80,0x01,0x1C,0x1C,0x70,0x00,0x80,0x03,0x0E,0x1C,0xF0,0x00,0x80,0x03,0x0E,0x1C,0xE0,0x00,0x00,0x07,0x0E,0x1C,0xE0,0x00,0x00,0x0E,0x0E,0x1C,0xE0,0x00,0x00,0x1C,0x0E,0x1C,0xE0,0x00,0x00,0x38,0x1E,0x1C,0xE0,0x00,0x00,0x30,0x1C,0x1C,0xE0,0x00,0x00,0x20,0x7C,0x1C,0x70,0x00,0x00,0x00,0xF8,0x1F,0x70,0x00,0x00,0x00,0xF0,0x1F,0x70,0x00,0x00,0x00,0xE0,0x1F,0x78,0x00,0x00,0x00,0x00,0x1F,0x38, // 232
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x1D,0x3F,0x00,0x00,0x00,0x7C,0x1C,0x7C,0x00,0x00,0x00,0x3C,0x1C,0x78,0x00,0x00,0x00,0x1C,0x1C,0x70,0x00,0x00,0x20,0x0E,0x1C,0xF0,0x00,0x00,0x30,0x0E,0x1C,0xE0,0x00,0x00,0x38,0x0E,0x1C,0xE0,0x00,0x00,0x1C,0x0E,0x1C,0xE0,0x00,0x00,0x0E,0x0E,0x1C,0xE0,0x00,0x00,0x07,0x1E,0x1C,0xE0,0x00,0x80,0x07,0x1C,0x1C,0xE0,0x00,0x80,0x03,0x7C,0x1C,0x70,0x00,0x80,0x01,0xF8,0x1F,0x70,0x00,0x80,0x00,0xF0,0x1F,0x70,0x00,0x00,0x00,0xE0,0x1F,0x78,0x00,0x00,0x00,0x00,0x1F,0x38, // 233
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x1D,0x3F,0x00,0x00,0x00,0x7C,0x1C,0x7C,0x00,0x00,0x30,0x3C,0x1C,0x78,0x00,0x00,0x38,0x1C,0x1C,0x70,0x00,0x00,0x3C,0x0E,0x1C,0xF0,0x00,0x00,0x1F,0x0E,0x1C,0xE0,0x00,0x80,0x07,0x0E,0x1C,0xE0,0x00,0x80,0x07,0x0E,0x1C,0xE0,0x00,0x80,0x0F,0x0E,0x1C,0xE0,0x00,0x00,0x1E,0x1E,0x1C,0xE0,0x00,0x00,0x3C,0x1C,0x1C,0xE0,0x00,0x00,0x30,0x7C,0x1C,0x70,0x00,0x00,0x20,0xF8,0x1F,0x70,0x00,0x00,0x00,0xF0,0x1F,0x70,0x00,0x00,0x00,0xE0,0x1F,0x78,0x00,0x00,0x00,0x00,0x1F,0x38, // 234
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x18,0xF8,0x1D,0x3F,0x00,0x00,0x3C,0x7C,0x1C,0x7C,0x00,0x00,0x3C,0x3C,0x1C,0x78,0x00,0x00,0x18,0x1C,0x1C,0x70,0x00,0x00,0x00,0x0E,0x1C,0xF0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x0E,0x1C,0xE0,0x00,0x00,0x00,0x1E,0x1C,0xE0,0x00,0x00,0x18,0x1C,0x1C,0xE0,0x00,0x00,0x3C,0x7C,0x1C,0x70,0x00,0x00,0x3C,0xF8,0x1F,0x70,0x00,0x00,0x18,0xF0,0x1F,0x70,0x00,0x00,0x00,0xE0,0x1F,0x78,0x00,0x00,0x00,0x00,0x1F,0x38, // 235
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x80,0x00,0x0E,0x00,0x00,0x00,0x80,0x00,0x0E,0x00,0x00,0x00,0x80,0x01,0x0E,0x00,0x00,0x00,0x80,0x03,0xFE,0xFF,0xFF,0x00,0x00,0x07,0xFE,0xFF,0xFF,0x00,0x00,0x0E,0xFE,0xFF,0xFF,0x00,0x00,0x1C,0xFE,0xFF,0xFF,0x00,0x00,0x38,0x00,0x00,0xE0,0x00,0x00,0x30,0x00,0x00,0xE0,0x00,0x00,0x20,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0, // 236
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x20,0x0E,0x00,0x00,0x00,0x00,0x30,0x0E,0x00,0x00,0x00,0x00,0x38,0xFE,0xFF,0xFF,0x00,0x00,0x1C,0xFE,0xFF,0xFF,0x00,0x00,0x1E,0xFE,0xFF,0xFF,0x00,0x00,0x0F,0xFE,0xFF,0xFF,0x00,0x80,0x07,0x00,0x00,0xE0,0x00,0x80,0x03,0x00,0x00,0xE0,0x00,0x80,0x01,0x00,0x00,0xE0,0x00,0x80,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0, // 237
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x20,0x0E,0x00,0x00,0x00,0x00,0x38,0x0E,0x00,0x00,0x00,0x00,0x3C,0x0E,0x00,0x00,0x00,0x00,0x1E,0xFE,0xFF,0xFF,0x00,0x80,0x0F,0xFE,0xFF,0xFF,0x00,0x80,0x03,0xFE,0xFF,0xFF,0x00,0x80,0x0F,0xFE,0xFF,0xFF,0x00,0x00,0x1F,0x00,0x00,0xE0,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0xE0,0x00,0x00,0x20,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0, // 238
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x18,0x0E,0x00,0x00,0x00,0x00,0x3C,0x0E,0x00,0x00,0x00,0x00,0x3C,0x0E,0x00,0x00,0x00,0x00,0x18,0x0E,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x18,0x00,0x00,0xE0,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x18,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0, // 239
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0x00,0x80,0x03,0xE0,0xFF,0x0F,0x00,0x80,0x03,0xF0,0xFF,0x1F,0x00,0x80,0x63,0xF0,0x03,0x3F,0x00,0x80,0xE3,0xF8,0x00,0x7C,0x00,0x80,0xF3,0x79,0x00,0x78,0x00,0x80,0xFF,0x3C,0x00,0xF0,0x00,0x00,0x7F,0x1C,0x00,0xE0,0x00,0x00,0x3F,0x1C,0x00,0xE0,0x00,0x00,0x1F,0x1C,0x00,0xE0,0x00,0x80,0x1F,0x1C,0x00,0xE0,0x00,0xC0,0x3F,0x1C,0x00,0xE0,0x00,0xE0,0xFF,0x38,0x00,0xF0,0x00,0xF0,0xF9,0x79,0x00,0x78,0x00,0xE0,0xF1,0xF7,0x00,0x7C,0x00,0xC0,0xE0,0xFF,0x03,0x3F,0x00,0x00,0x80,0xFF,0xFF,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x0F,0x00,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x00,0xC0,0xFF,  // 240
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x20,0xFE,0xFF,0xFF,0x00,0x00,0x38,0xFE,0xFF,0xFF,0x00,0x00,0x3C,0xC0,0x03,0x00,0x00,0x00,0x0C,0xF0,0x00,0x00,0x00,0x00,0x0C,0x78,0x00,0x00,0x00,0x00,0x0C,0x38,0x00,0x00,0x00,0x00,0x1C,0x1C,0x00,0x00,0x00,0x00,0x18,0x1C,0x00,0x00,0x00,0x00,0x30,0x0E,0x00,0x00,0x00,0x00,0x30,0x0E,0x00,0x00,0x00,0x00,0x30,0x0E,0x00,0x00,0x00,0x00,0x38,0x1E,0x00,0x00,0x00,0x00,0x1C,0x3E,0x00,0x00,0x00,0x00,0x1C,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x00,0x00,0x00,0xE0,0xFF,0xFF, // 241
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x80,0x00,0x7C,0x00,0x7C,0x00,0x80,0x00,0x3C,0x00,0x78,0x00,0x80,0x01,0x1E,0x00,0xF0,0x00,0x80,0x03,0x0E,0x00,0xE0,0x00,0x00,0x07,0x0E,0x00,0xE0,0x00,0x00,0x0E,0x0E,0x00,0xE0,0x00,0x00,0x1C,0x0E,0x00,0xE0,0x00,0x00,0x38,0x0E,0x00,0xE0,0x00,0x00,0x30,0x1E,0x00,0xF0,0x00,0x00,0x20,0x1C,0x00,0x70,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,  // 242
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x00,0x20,0x3C,0x00,0x78,0x00,0x00,0x30,0x1E,0x00,0xF0,0x00,0x00,0x38,0x0E,0x00,0xE0,0x00,0x00,0x1C,0x0E,0x00,0xE0,0x00,0x00,0x1E,0x0E,0x00,0xE0,0x00,0x00,0x0F,0x0E,0x00,0xE0,0x00,0x80,0x07,0x0E,0x00,0xE0,0x00,0x80,0x03,0x1E,0x00,0xF0,0x00,0x80,0x01,0x1C,0x00,0x70,0x00,0x80,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,  // 243
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x20,0x7C,0x00,0x7C,0x00,0x00,0x38,0x3C,0x00,0x78,0x00,0x00,0x3C,0x1E,0x00,0xF0,0x00,0x00,0x1F,0x0E,0x00,0xE0,0x00,0x80,0x0F,0x0E,0x00,0xE0,0x00,0x80,0x03,0x0E,0x00,0xE0,0x00,0x80,0x0F,0x0E,0x00,0xE0,0x00,0x00,0x1F,0x0E,0x00,0xE0,0x00,0x00,0x3C,0x1E,0x00,0xF0,0x00,0x00,0x38,0x1C,0x00,0x70,0x00,0x00,0x20,0x7C,0x00,0x7C,0x00,0x00,0x00,0xF8,0x01,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,  // 244
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x30,0xF0,0xFF,0x1F,0x00,0x00,0x38,0xF8,0x01,0x3F,0x00,0x00,0x3C,0x7C,0x00,0x7C,0x00,0x00,0x0C,0x3C,0x00,0x78,0x00,0x00,0x0C,0x1E,0x00,0xF0,0x00,0x00,0x0C,0x0E,0x00,0xE0,0x00,0x00,0x18,0x0E,0x00,0xE0,0x00,0x00,0x18,0x0E,0x00,0xE0,0x00,0x00,0x30,0x0E,0x00,0xE0,0x00,0x00,0x30,0x0E,0x00,0xE0,0x00,0x00,0x30,0x1E,0x00,0xF0,0x00,0x00,0x3C,0x1C,0x00,0x70,0x00,0x00,0x1C,0x7C,0x00,0x7C,0x00,0x00,0x0C,0xF8,0x01,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,  // 245
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x18,0xF0,0xFF,0x1F,0x00,0x00,0x3C,0xF8,0x01,0x3F,0x00,0x00,0x3C,0x7C,0x00,0x7C,0x00,0x00,0x18,0x3C,0x00,0x78,0x00,0x00,0x00,0x1E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xE0,0x00,0x00,0x18,0x1E,0x00,0xF0,0x00,0x00,0x3C,0x1C,0x00,0x70,0x00,0x00,0x3C,0x7C,0x00,0x7C,0x00,0x00,0x18,0xF8,0x01,0x3F,0x00,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x0F,0x00,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0xFE,  // 246
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0xF0,0x70,0x78,0x00,0x00,0x00,0xF8,0x71,0xFC,0x00,0x00,0x00,0xF8,0x71,0xFC,0x00,0x00,0x00,0xF8,0x71,0xFC,0x00,0x00,0x00,0xF8,0x71,0xFC,0x00,0x00,0x00,0xF0,0x70,0x78,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,  // 247
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x01,0x00,0x00,0xC0,0xFF,0x87,0x01,0x00,0x00,0xE0,0xFF,0xEF,0x01,0x00,0x00,0xF8,0xFF,0xFF,0x01,0x00,0x00,0xF8,0x01,0xFF,0x01,0x00,0x00,0x3C,0x00,0xFE,0x00,0x00,0x00,0x1C,0x00,0x7F,0x00,0x00,0x00,0x1E,0xC0,0xFF,0x00,0x00,0x00,0x0E,0xE0,0xEF,0x00,0x00,0x00,0x0E,0xF8,0xE3,0x00,0x00,0x00,0x0E,0xFC,0xE1,0x00,0x00,0x00,0x0E,0x7F,0xE0,0x00,0x00,0x00,0x8E,0x3F,0xE0,0x00,0x00,0x00,0xEE,0x0F,0xE0,0x00,0x00,0x00,0xFE,0x07,0xF0,0x00,0x00,0x00,0xFC,0x01,0x70,0x00,0x00,0x00,0xFE,0x00,0x78,0x00,0x00,0x00,0xFF,0x00,0x3F,0x00,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0x00,0xEF,0xFF,0x0F,0x00,0x00,0x00,0xC3,0xFF,0x07,0x00,0x00,0x00,0x01,0xFE,  // 248
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x80,0x00,0x00,0x00,0xF8,0x00,0x80,0x00,0x00,0x00,0xF0,0x00,0x80,0x01,0x00,0x00,0xE0,0x00,0x80,0x03,0x00,0x00,0xE0,0x00,0x00,0x07,0x00,0x00,0xE0,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x1C,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x30,0x00,0x00,0x3C,0x00,0x00,0x20,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF, // 249
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x20,0x00,0x00,0xE0,0x00,0x00,0x30,0x00,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0xE0,0x00,0x00,0x1C,0x00,0x00,0x70,0x00,0x00,0x0E,0x00,0x00,0x70,0x00,0x00,0x0F,0x00,0x00,0x38,0x00,0x80,0x07,0x00,0x00,0x3C,0x00,0x80,0x03,0x00,0x00,0x1E,0x00,0x80,0x01,0x00,0x80,0x07,0x00,0x80,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF, // 250
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x20,0x00,0x00,0xF8,0x00,0x00,0x38,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x00,0x1E,0x00,0x00,0xE0,0x00,0x80,0x0F,0x00,0x00,0xE0,0x00,0x80,0x03,0x00,0x00,0x70,0x00,0x80,0x0F,0x00,0x00,0x70,0x00,0x00,0x1F,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x1E,0x00,0x00,0x20,0x00,0x80,0x07,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF, // 251
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x18,0xFE,0xFF,0x7F,0x00,0x00,0x3C,0xFE,0xFF,0x7F,0x00,0x00,0x3C,0x00,0x00,0xF8,0x00,0x00,0x18,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x80,0x07,0x00,0x00,0x18,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x00,0x00,0x00,0xFE,0xFF,0xFF, // 252
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x10,0x00,0x20,0x00,0xFC,0x07,0x1C,0x00,0x30,0x00,0xE0,0x3F,0x1E,0x00,0x38,0x00,0x80,0xFF,0x1F,0x00,0x1C,0x00,0x00,0xFE,0x0F,0x00,0x0E,0x00,0x00,0xFE,0x07,0x00,0x0F,0x00,0xC0,0xFF,0x01,0x80,0x07,0x00,0xF0,0x7F,0x00,0x80,0x03,0x00,0xFE,0x0F,0x00,0x80,0x01,0x80,0xFF,0x03,0x00,0x80,0x00,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x02, // 253
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0xE0,0x03,0xE0,0x00,0x00,0x00,0xF0,0x00,0xE0,0x00,0x00,0x00,0x78,0x00,0xE0,0x00,0x00,0x00,0x38,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x1C,0x00,0xE0,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0xF0,0x00,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x00,0x1E,0x00,0x7C,0x00,0x00,0x00,0x1E,0x00,0x3E,0x00,0x00,0x00,0x7C,0x80,0x1F,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0x00,0x80,0x7F,  // 254
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x00,0x18,0xFC,0x07,0x00,0x00,0x00,0x3C,0xF0,0x1F,0x00,0x00,0x00,0x3C,0xC0,0x7F,0x00,0x00,0x00,0x18,0x00,0xFF,0x01,0x10,0x00,0x00,0x00,0xFC,0x07,0x1C,0x00,0x00,0x00,0xE0,0x3F,0x1E,0x00,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x18,0x00,0xF0,0x7F,0x00,0x00,0x3C,0x00,0xFE,0x0F,0x00,0x00,0x3C,0x80,0xFF,0x03,0x00,0x00,0x18,0xF0,0x7F,0x00,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x02  // 255
+  0xFD,0x00,0xFF,0x80,0xFC,0xC0,0x04,0xE0,0xF0,0xF8,0xFC,0xFC,0xF7,0xFE,0xFF,0xFC,0x02,0xF8,0xF0,0xE0,0xFC,0xC0,0xFF,0x80,0xFD,0x00,0x02,0xF0,0xFC,0xFE,0xDD,0xFF,0x08,0xFE,0xFC,0xF0,0x03,0x0F,0x1F,0x3F,0x7F,0x7F,0xE3,0xFF,0xFF,0x7F,0x0E,0x3F,0x1F,0x0F,0x03,0x00,0x00,0x80,0xC0,0xF8,0xF0,0xB0,0xBC,0xE0,0x60,0x20,0xFE,0x00,0x0D,0x01,0x83,0x83,0x03,0x07,0x87,0xF7,0xF7,0x87,0x07,0x03,0x83,0x83,0x01,0xFE,0x00,0xFE,0x80,0x04,0xE0,0xC0,0x80,0xC0,0x40,0xF9,0x00,0x04,0x07,0x03,0x01,0x03,0x03,0xFC,0x00,0x01,0xE3,0xF3,0xFE,0x7F,0xFF,0xE3,0xFE,0x7F,0x01,0xF3,0xE3,0xFD,0x00,0x07,0x01,0x09,0x0F,0x07,0x1C,0x1F,0x07,0x06,0xEA,0x00,0xFF,0x07, // 35
+  0xF6,0x00,0x03,0x80,0xC0,0xE0,0xE0,0xFD,0xF0,0x03,0xF8,0xFC,0xFE,0xFE,0xFA,0xFF,0xFF,0xFE,0x01,0xFC,0xF8,0xFD,0xF0,0x02,0xE0,0xC0,0x80,0xFE,0x00,0x02,0x80,0xC0,0xC0,0xFE,0xE0,0xFE,0xF0,0xE4,0xFF,0x03,0x7F,0x3F,0xF8,0xFE,0xDB,0xFF,0x08,0xFE,0xF8,0x00,0x07,0x0F,0x1F,0x1F,0x3F,0x3F,0xFD,0x7F,0xFF,0x3F,0x00,0x7F,0xF3,0xFF,0x02,0x7F,0x3F,0x3F,0xFD,0x7F,0xFF,0x3F,0xFF,0x1F,0x01,0x0F,0x07,0xF0,0x00,0x06,0x05,0xCF,0xFF,0xFF,0x7F,0x39,0x31,0xFE,0x01,0xE1,0x00,0x01,0x03,0x01, // 38
+  0xD3,0x00,0xFE,0x80,0xFB,0x00,0xFE,0x80,0xFC,0x00,0x02,0x80,0xE0,0xE0,0xFB,0x00,0xFE,0x80,0xF4,0x00,0xFE,0xFF,0x05,0x07,0x1E,0x3C,0xF0,0xE0,0x80,0xFE,0xFF,0xFE,0x00,0x03,0xE0,0xFC,0x3F,0x07,0xFE,0x00,0x09,0x80,0xE0,0xFC,0xFF,0x8F,0x83,0x9F,0xFE,0xF0,0xC0,0xF7,0x00,0xFE,0x0F,0xFD,0x00,0x01,0x01,0x07,0xFE,0x0F,0x04,0x00,0x18,0x1F,0x0F,0x01,0xFD,0x00,0x02,0x0C,0x0F,0x0F,0xFB,0x03,0xFF,0x0F,0x01,0x0E,0x08, // 41
+  0xF5,0x00,0x03,0x80,0xC0,0xE0,0xF0,0xFE,0x70,0x03,0xF8,0x7C,0x3C,0x1C,0xFB,0x0E,0x03,0x1E,0x1C,0x3C,0xF8,0xFE,0x70,0x04,0xF0,0xE0,0xE0,0xC0,0x80,0xFD,0x00,0x02,0x80,0xC0,0xC0,0xFC,0xE0,0x06,0xFF,0x7F,0x3F,0x1D,0x1E,0x0E,0x0E,0xFB,0x07,0x06,0x0F,0x0E,0x1E,0x1C,0x3C,0x78,0xF0,0xFD,0xE0,0xFF,0xC0,0x0B,0x80,0xC3,0xFF,0xFF,0x3E,0xF8,0xFE,0xFF,0x07,0x03,0x01,0x01,0xE5,0x00,0xFF,0x01,0x0B,0x03,0x07,0xFF,0xFC,0xF8,0x00,0x03,0x07,0x0F,0x1E,0x1C,0x3C,0xFC,0x38,0xFF,0x3C,0x0F,0x18,0x00,0xC0,0xC0,0xE0,0xF0,0xF0,0xB8,0x0C,0x02,0x40,0xE0,0xF0,0x70,0x3C,0x1C,0xFC,0x38,0x05,0x3C,0x1C,0x1E,0x0F,0x07,0x03,0xEF,0x00,0x05,0xE1,0x7F,0x3F,0x1F,0x0F,0x06,0xDE,0x00,0x00,0x01, // 48
+  0xC9,0x00,0x03,0x80,0xC0,0xC0,0xE0,0xDD,0x00,0x00,0xF8,0xFC,0xFF,0x03,0xF0,0xE0,0xC0,0x80,0xE0,0x00,0x03,0x03,0x0F,0x0F,0x1F,0xFD,0x3F,0x08,0x7F,0x3F,0x3F,0x3E,0x3E,0x1E,0x0E,0x06,0x02, // 50
+  0xFC,0x00,0xFE,0xC0,0x00,0x80,0xFA,0x00,0xFE,0x3E,0xFA,0x00,0x03,0x80,0xC0,0xE0,0x60,0xEF,0x00,0x08,0x01,0x03,0x83,0xE0,0xF0,0x78,0x3C,0x1C,0x1E,0xFC,0x0E,0x07,0x1E,0x1C,0x3C,0x78,0xF0,0xE1,0x01,0x01,0xF3,0x00,0xFE,0x07,0xFF,0x87,0xFE,0xC0,0x09,0xEF,0xFF,0xFF,0xF0,0xF0,0xF8,0xFC,0xFC,0xFE,0xFE,0xF8,0xFF,0xFF,0xFC,0x01,0xFA,0xF7,0xFE,0xE7,0x04,0xE0,0xC0,0xC0,0x80,0x80,0xFE,0x00,0x01,0xF0,0xFC,0xDB,0xFF,0x06,0xFE,0xF8,0x01,0x07,0x0F,0x1F,0x3F,0xF8,0x7F,0xF2,0xFF,0xF9,0x7F,0x04,0x3F,0x1F,0x1F,0x07,0x01,0xF2,0x00,0xFE,0x01,0xFA,0x03,0xFF,0x01, // 51
+  0xEC,0x00,0x06,0xC0,0xE0,0xE0,0xF0,0xF8,0xF8,0x10,0xE0,0x00,0x0B,0xFC,0xFF,0xFF,0x03,0x01,0x01,0x1F,0x3F,0xFC,0xF0,0xE0,0xC0,0xF9,0x80,0xFB,0x00,0x02,0x80,0xC0,0xC0,0xFC,0xE0,0x02,0xF0,0xF8,0xFC,0xFE,0xFE,0xFC,0xFF,0xFD,0xFE,0xFF,0xFC,0x01,0xF8,0xF1,0xFE,0xE3,0xFF,0xF7,0x03,0xFF,0xDF,0xCF,0x83,0xFE,0x00,0x01,0xF8,0xFE,0xDB,0xFF,0x07,0xFE,0xF8,0x01,0x07,0x0F,0x1F,0x3F,0x3F,0xFB,0x7F,0x01,0x3F,0x7F,0xF3,0xFF,0x01,0x7F,0x3F,0xFB,0x7F,0xFF,0x3F,0x03,0x1F,0x0F,0x07,0x01,0xF2,0x00,0xFE,0x01,0xFB,0x03,0xFE,0x01, // 52
+  0xD3,0x00,0xFF,0x80,0xFC,0xC0,0x05,0xE0,0xF0,0xF8,0xF8,0xFC,0xFC,0xF9,0xFE,0xFF,0xFC,0xFF,0xF8,0x01,0xF0,0xE0,0xFC,0xC0,0xFF,0x80,0xFD,0x00,0x02,0xF0,0xFC,0xFE,0xDD,0xFF,0x08,0xFE,0xFC,0xF0,0x01,0x07,0x0F,0x1F,0x3F,0x3F,0xFB,0x7F,0x00,0x3F,0xF1,0xFF,0x00,0x3F,0xFB,0x7F,0xFF,0x3F,0x03,0x1F,0x0F,0x07,0x01,0xF3,0x00,0xFF,0x01,0xFF,0x03,0xFB,0x07,0xFF,0x03,0xFF,0x01, // 53
+  0xF5,0x00,0x05,0x80,0xC0,0xE0,0xE0,0xF0,0xF0,0xFA,0xF8,0xFF,0xF0,0xFF,0xE0,0x01,0xC0,0x80,0xF6,0x00,0x05,0x80,0xE0,0xF0,0xF8,0xFC,0xFC,0xFC,0xFE,0xED,0xFF,0xFC,0xFE,0xFF,0xFC,0x05,0xF8,0xF0,0xE0,0x80,0x0F,0x3F,0xDB,0xFF,0x01,0x7F,0x1F,0xFD,0x00,0x00,0x01,0xFD,0x03,0x00,0x07,0xFD,0x03,0x00,0x07,0xFE,0x0F,0xFE,0x1F,0x00,0x9F,0xFE,0x1F,0xFF,0x0F,0xFF,0x07,0xF9,0x03,0xFF,0x01,0xEB,0x00,0x04,0x38,0x7E,0x7F,0x7E,0x38, // 55
+  0xC8,0x00,0xFE,0x80,0xFF,0xC0,0x00,0xE0,0xFE,0xF0,0xFD,0xF8,0xFE,0xF0,0x02,0xE0,0xC0,0xC0,0xFE,0x80,0xF9,0x00,0xFA,0x38,0x03,0x10,0xF0,0xFC,0xFE,0xE9,0xFF,0x03,0xFE,0xFC,0xF0,0x00,0xF9,0x77,0xFE,0x70,0x04,0x71,0x27,0x0F,0x1F,0x1F,0xFB,0x3F,0xF9,0x7F,0xFB,0x3F,0xFF,0x1F,0x02,0x0F,0x07,0x01, // 57
+  0xED,0x00,0xFE,0xE0,0xE5,0x00,0x06,0x06,0x0E,0x1C,0x18,0x00,0x80,0xC0,0xFE,0xE0,0x00,0x70,0xFE,0x73,0x00,0x70,0xFE,0xE0,0x06,0xC0,0x80,0x00,0x18,0x1C,0x0E,0x06,0xF5,0x00,0xFC,0x70,0xFE,0x00,0x04,0xF8,0xFF,0xFF,0x07,0x01,0xF8,0x00,0x06,0x01,0x07,0xFF,0xFF,0xF8,0x00,0x00,0xFC,0x70,0xF4,0x00,0x09,0x80,0xC0,0xE0,0x60,0x03,0x07,0x0F,0x1E,0x1C,0x3C,0xFB,0x38,0x08,0x1C,0x1E,0x0F,0x07,0x03,0x60,0xE0,0xC0,0x80,0xF0,0x00,0xFF,0x01,0xF8,0x00,0xFE,0x1F,0xF9,0x00,0x02,0x01,0x03,0x01, // 66
+  0xD4,0x00,0xF6,0xE0,0x04,0xF0,0xF8,0xFC,0xFC,0xEC,0xFD,0xEE,0x09,0x4E,0x0E,0x0E,0x1C,0x3C,0x38,0x78,0xF0,0xE0,0x80,0xF2,0x00,0xFC,0x38,0x03,0xFE,0xFF,0xFF,0x39,0xF2,0x38,0x03,0x39,0xFF,0xFF,0xFE,0xFA,0x38,0xFD,0x00,0xF6,0x07,0x04,0x0F,0x1F,0x3F,0x3F,0x37,0xFA,0x77,0x04,0x37,0x3F,0x3F,0x1F,0x0F,0xFC,0x07,0x00,0x02, // 69
+  0xC4,0x00,0xFF,0xE0,0xFD,0xF0,0x01,0xE0,0xC0,0xED,0x00,0x00,0xE0,0xEE,0xE7,0x01,0xE3,0xE1,0xFD,0xE0,0x01,0xFC,0xFE,0xFD,0xFF,0x01,0x7E,0x3C,0xF8,0x00,0xEF,0x1C,0xFB,0xFC,0x01,0xF8,0xF0,0xDE,0x00,0x00,0x01,0xFD,0x03,0x00,0x01, // 70
+  0xFC,0x00,0xFF,0xE0,0x01,0xC0,0x80,0xFA,0x00,0xFE,0x3E,0xFA,0x00,0x03,0x80,0xC0,0xE0,0x40,0xEF,0x00,0x08,0x03,0x07,0x87,0xE0,0xF0,0x78,0x3C,0x1C,0x1E,0xFC,0x0E,0x07,0x1E,0x1C,0x3C,0x78,0xF0,0xC1,0x03,0x01,0xF3,0x00,0xFE,0x07,0x0E,0x87,0xC7,0xC0,0xC0,0xE0,0xEF,0xFF,0xFF,0xF0,0xF0,0x78,0x3C,0x1E,0x0E,0x0E,0xFB,0x07,0xFF,0x0F,0x04,0x0E,0x1C,0x3C,0x7F,0xF7,0xFE,0xE7,0xFF,0xE0,0xFF,0xC0,0x00,0x80,0xFE,0x00,0x06,0xF8,0xFE,0xFF,0x0F,0x03,0x01,0x01,0xFD,0x00,0x00,0x01,0xEA,0x00,0xFF,0x01,0x0B,0x03,0x0F,0xFF,0xFE,0xF8,0x01,0x07,0x0F,0x1F,0x3C,0x38,0x78,0xFC,0x70,0xFF,0x78,0x03,0xF0,0xE0,0xC0,0xC0,0xFB,0x80,0xFE,0xC0,0x02,0xE0,0x70,0x78,0xFC,0x70,0x06,0x78,0x38,0x3C,0x1F,0x0F,0x07,0x01,0xF1,0x00,0xFF,0x01,0xFA,0x03,0xFF,0x01, // 72
+  0xED,0x00,0xFE,0xF8,0xF8,0x00,0x00,0x80,0xEF,0x00,0xFF,0x07,0x07,0x0E,0x0C,0x80,0xC0,0xE0,0xF0,0x70,0x78,0xFC,0x38,0x09,0x78,0x70,0xF0,0xE0,0xC0,0x80,0x0E,0x0F,0x07,0x03,0xF5,0x00,0xFC,0x9C,0xFE,0x80,0x03,0x9E,0x9F,0x9F,0x81,0xF6,0x80,0x05,0x81,0x9F,0x9F,0x9E,0x80,0x80,0xFC,0x9C,0xF9,0x00,0xDF,0x73,0xF9,0x00,0xDF,0x0E, // 74
+  0xCF,0x00,0xE7,0x38,0xF1,0x00,0xE7,0xE7,0xF1,0x00,0xE7,0x1C, // 77
+  0xF5,0x00,0xFF,0xC0,0x03,0xE0,0xF0,0x70,0x78,0xFC,0x38,0x06,0x78,0x70,0x70,0xE0,0xE0,0xC0,0x80,0xF5,0x00,0x06,0x80,0xE0,0xF0,0xF8,0x3C,0x1C,0x1E,0xFD,0x0E,0x02,0x0F,0x07,0x01,0xF4,0x00,0x03,0x01,0x03,0x0F,0x0F,0xFD,0x0E,0xFF,0x1C,0x0B,0x3C,0xF8,0xF0,0xE0,0x80,0x1F,0x7F,0xFF,0xF0,0xC0,0x80,0x80,0xFC,0x00,0xFF,0x80,0xF3,0x00,0xFF,0x80,0xFC,0x00,0xFF,0x80,0x04,0xC0,0xF0,0xFF,0x7F,0x1F,0xFE,0x00,0x02,0x01,0x03,0x03,0xFC,0x07,0xFE,0x03,0x02,0x07,0x0E,0x0E,0xFE,0x1C,0x00,0x9C,0xFE,0x1C,0xFF,0x0E,0xFF,0x07,0xFF,0x03,0xFC,0x07,0xFE,0x03,0x00,0x01,0xEC,0x00,0x04,0x38,0x7E,0x7F,0x7E,0x38, // 81
+  0xFD,0x00,0xFF,0x80,0xFC,0xC0,0x05,0xE0,0xF0,0x78,0x38,0x1C,0x1C,0xFA,0x0E,0xFF,0x1C,0x04,0x3C,0x38,0x78,0xF0,0xE0,0xFC,0xC0,0xFF,0x80,0xFD,0x00,0x06,0xF0,0xFC,0xFE,0x0F,0x07,0x03,0x03,0xFC,0x01,0xEF,0x00,0xFC,0x01,0xFF,0x03,0x0B,0x07,0x0F,0xFE,0xFC,0xF0,0x03,0x0F,0x1F,0x3E,0x78,0x70,0xF0,0xFC,0xE0,0x05,0x70,0xE0,0xC0,0xC0,0x80,0x80,0xFB,0x00,0xFF,0x80,0x03,0xC0,0xE0,0xE0,0x70,0xFC,0xE0,0x06,0xF0,0x70,0x78,0x3E,0x1F,0x0F,0x03,0xF9,0x00,0x08,0xC0,0xF0,0xF8,0xF0,0xC0,0x00,0x01,0x03,0x03,0xFA,0x07,0xFF,0x03,0xFF,0x01,0xFE,0x00,0x00,0x80,0xEE,0x00,0x02,0x01,0x03,0x01,0xFB,0x00,0x04,0xC0,0xF0,0xFC,0xF0,0xC0,0xFB,0x00,0x04,0x38,0x7E,0x7F,0x7E,0x38,0xE7,0x00,0x00,0x01,0xFE,0x03,0x00,0x01, // 82
+  0xC8,0x00,0xFF,0x80,0xFE,0xC0,0x03,0xE0,0xF0,0x70,0x78,0xFC,0x38,0x03,0x78,0x70,0xF0,0xE0,0xFE,0xC0,0xFF,0x80,0xFA,0x00,0xFA,0x1C,0x06,0x08,0xF8,0xFE,0xFF,0x0F,0x07,0x03,0xFD,0x01,0xF6,0x00,0xFD,0x01,0xFF,0x03,0x03,0x0F,0xFF,0xFE,0xF8,0xF9,0x77,0xFE,0x70,0x05,0x71,0x77,0x0F,0x0F,0x1E,0x1C,0xFB,0x38,0xFA,0x70,0xFB,0x38,0xFF,0x1C,0xFF,0x0F,0x01,0x07,0x01, // 83
+  0xFD,0x00,0xFF,0x80,0xFC,0xC0,0x06,0xE0,0xF0,0x70,0x38,0x3C,0x1C,0x1C,0xFB,0x0E,0x06,0x1E,0x1C,0x3C,0x38,0x78,0xF0,0xE0,0xFC,0xC0,0xFF,0x80,0xFD,0x00,0x06,0xF0,0xFC,0xFE,0x0F,0x07,0x03,0x03,0xFC,0x01,0xF0,0x00,0xFB,0x01,0xFF,0x03,0x0B,0x07,0x0F,0xFE,0xFC,0xF0,0x03,0x0F,0x1F,0x3E,0x78,0x70,0x70,0xFC,0xE0,0x07,0x70,0x10,0x00,0x00,0x80,0x80,0x00,0x80,0xFE,0xF0,0xFE,0x80,0xFF,0x00,0x01,0x10,0x70,0xFC,0xE0,0xFF,0x70,0x04,0x78,0x3E,0x1F,0x0F,0x03,0xF1,0x00,0x09,0x73,0x7F,0x3F,0x7F,0xF3,0xF3,0xFF,0x3F,0x7F,0x73,0xDD,0x00,0xFE,0x03, // 86
+  0xFD,0x00,0xFF,0x80,0xFC,0xC0,0x04,0xE0,0xF0,0x38,0x3C,0x1C,0xFE,0x0E,0xFD,0x06,0xFE,0x0E,0x04,0x1C,0x3C,0x38,0xF0,0xE0,0xFC,0xC0,0xFF,0x80,0xFD,0x00,0x05,0xF0,0xFC,0xFE,0x0F,0x03,0x03,0xFB,0x01,0xEF,0x00,0xFB,0x01,0xFF,0x03,0x0D,0x0F,0xFE,0xFC,0xF0,0x03,0x0F,0x1F,0x3C,0x70,0x70,0xE0,0xE0,0xC0,0xC0,0xFD,0xE0,0x02,0xC0,0x80,0x80,0xF9,0x00,0xFF,0x80,0x00,0xC0,0xFD,0xE0,0xFF,0xC0,0xFF,0xE0,0xFF,0x70,0x0E,0x3C,0x1F,0x0F,0x03,0x00,0x00,0x80,0xC0,0xF8,0xF0,0xB0,0xBC,0xE0,0x60,0x20,0xFE,0x00,0x0D,0x01,0x83,0x83,0x03,0x07,0x87,0xF7,0xF7,0x87,0x07,0x03,0x83,0x83,0x01,0xFE,0x00,0xFE,0x80,0x04,0xE0,0xC0,0x80,0xC0,0x40,0xF9,0x00,0x04,0x07,0x03,0x01,0x03,0x03,0xFC,0x00,0x01,0xE3,0xF3,0xFE,0x7F,0xFF,0xE3,0xFE,0x7F,0x01,0xF3,0xE3,0xFD,0x00,0x07,0x01,0x09,0x0F,0x07,0x1C,0x1F,0x07,0x06,0xEA,0x00,0xFF,0x07, // 87
+  0xCB,0x00,0x02,0x80,0xC0,0xC0,0xFD,0xE0,0x04,0xF0,0x78,0x3C,0x1C,0x1E,0xFC,0x0E,0xFF,0x1C,0x01,0x38,0xF8,0xFD,0xE0,0xFF,0xC0,0x00,0x80,0xFC,0x00,0x02,0x80,0xC0,0xC0,0xFC,0xE0,0x06,0xFE,0xFF,0x3F,0x1D,0x1F,0x0E,0x0E,0xFB,0x07,0x06,0x0F,0x0E,0x1E,0x1C,0x3C,0x78,0xF0,0xFD,0xE0,0xFF,0xC0,0x0B,0x81,0xC3,0xFF,0xFF,0x3E,0xF8,0xFE,0xFF,0x0F,0x03,0x01,0x01,0xFD,0x00,0x00,0x01,0xEA,0x00,0xFF,0x01,0x0B,0x03,0x0F,0xFF,0xFC,0xF0,0x01,0x07,0x0F,0x1F,0x3C,0x38,0x78,0xFC,0x70,0x05,0x38,0x78,0xF0,0xE0,0xC0,0xC0,0xFB,0x80,0xFF,0xC0,0x03,0xE0,0xF0,0x78,0x38,0xFC,0x70,0x06,0x78,0x38,0x3C,0x1F,0x0F,0x07,0x01,0xF2,0x00,0xFE,0x01,0xFB,0x03,0xFE,0x01 // 89
 };
-#define FONT_LIB_V3
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
+
+// Generated by fontconv from fonts.h, packed
+// Characters: #&)0234579BEFHJMQRSVWY
 const char Meteocons_Plain_21[] PROGMEM = {
   0x15, // Width: 21
-  0x16, // Height: 22
-  0x20, // First Char: 32
-  0xE0, // Numbers of Chars: 224
+  0x96, // Height: 22, packed
+  0x23, // First Char: 35
+  0x37, // Numbers of Chars: 55
 
   // Jump Table:
-  0xFF, 0xFF, 0x00, 0x0B,  // 32:65535
-  0x00, 0x00, 0x3D, 0x15,  // 33:0
-  0x00, 0x3D, 0x3E, 0x15,  // 34:61
-  0x00, 0x7B, 0x3E, 0x15,  // 35:123
-  0x00, 0xB9, 0x3E, 0x15,  // 36:185
-  0x00, 0xF7, 0x3E, 0x15,  // 37:247
-  0x01, 0x35, 0x3E, 0x15,  // 38:309
-  0x01, 0x73, 0x27, 0x15,  // 39:371
-  0x01, 0x9A, 0x3B, 0x15,  // 40:410
-  0x01, 0xD5, 0x38, 0x15,  // 41:469
-  0x02, 0x0D, 0x29, 0x15,  // 42:525
-  0x02, 0x36, 0x2C, 0x15,  // 43:566
-  0x02, 0x62, 0x18, 0x0D,  // 44:610
-  0x02, 0x7A, 0x20, 0x0D,  // 45:634
-  0x02, 0x9A, 0x15, 0x0D,  // 46:666
-  0x02, 0xAF, 0x1F, 0x0D,  // 47:687
-  0x02, 0xCE, 0x3E, 0x15,  // 48:718
-  0x03, 0x0C, 0x38, 0x15,  // 49:780
-  0x03, 0x44, 0x2C, 0x15,  // 50:836
-  0x03, 0x70, 0x3E, 0x15,  // 51:880
-  0x03, 0xAE, 0x3F, 0x15,  // 52:942
-  0x03, 0xED, 0x3E, 0x15,  // 53:1005
-  0x04, 0x2B, 0x3E, 0x15,  // 54:1067
-  0x04, 0x69, 0x3E, 0x15,  // 55:1129
-  0x04, 0xA7, 0x3E, 0x15,  // 56:1191
-  0x04, 0xE5, 0x3E, 0x15,  // 57:1253
-  0x05, 0x23, 0x15, 0x0D,  // 58:1315
-  0x05, 0x38, 0x18, 0x0D,  // 59:1336
-  0x05, 0x50, 0x27, 0x0D,  // 60:1360
-  0x05, 0x77, 0x24, 0x0D,  // 61:1399
-  0x05, 0x9B, 0x26, 0x0D,  // 62:1435
-  0x05, 0xC1, 0x20, 0x0D,  // 63:1473
-  0x05, 0xE1, 0x26, 0x0D,  // 64:1505
-  0x06, 0x07, 0x31, 0x15,  // 65:1543
-  0x06, 0x38, 0x38, 0x15,  // 66:1592
-  0x06, 0x70, 0x2C, 0x15,  // 67:1648
-  0x06, 0x9C, 0x32, 0x15,  // 68:1692
-  0x06, 0xCE, 0x3E, 0x15,  // 69:1742
-  0x07, 0x0C, 0x3B, 0x15,  // 70:1804
-  0x07, 0x47, 0x2F, 0x15,  // 71:1863
-  0x07, 0x76, 0x3E, 0x15,  // 72:1910
-  0x07, 0xB4, 0x3E, 0x15,  // 73:1972
-  0x07, 0xF2, 0x39, 0x15,  // 74:2034
-  0x08, 0x2B, 0x39, 0x15,  // 75:2091
-  0x08, 0x64, 0x3F, 0x15,  // 76:2148
-  0x08, 0xA3, 0x32, 0x15,  // 77:2211
-  0x08, 0xD5, 0x3E, 0x15,  // 78:2261
-  0x09, 0x13, 0x3E, 0x15,  // 79:2323
-  0x09, 0x51, 0x3E, 0x15,  // 80:2385
-  0x09, 0x8F, 0x3E, 0x15,  // 81:2447
-  0x09, 0xCD, 0x3E, 0x15,  // 82:2509
-  0x0A, 0x0B, 0x3E, 0x15,  // 83:2571
-  0x0A, 0x49, 0x3D, 0x15,  // 84:2633
-  0x0A, 0x86, 0x3E, 0x15,  // 85:2694
-  0x0A, 0xC4, 0x3E, 0x15,  // 86:2756
-  0x0B, 0x02, 0x3E, 0x15,  // 87:2818
-  0x0B, 0x40, 0x3E, 0x15,  // 88:2880
-  0x0B, 0x7E, 0x3E, 0x15,  // 89:2942
-  0x0B, 0xBC, 0x3E, 0x15,  // 90:3004
-  0x0B, 0xFA, 0x21, 0x0D,  // 91:3066
-  0x0C, 0x1B, 0x24, 0x0D,  // 92:3099
-  0x0C, 0x3F, 0x18, 0x0D,  // 93:3135
-  0x0C, 0x57, 0x23, 0x0D,  // 94:3159
-  0x0C, 0x7A, 0x24, 0x0D,  // 95:3194
-  0x0C, 0x9E, 0x19, 0x0D,  // 96:3230
-  0x0C, 0xB7, 0x24, 0x0D,  // 97:3255
-  0x0C, 0xDB, 0x23, 0x0D,  // 98:3291
-  0x0C, 0xFE, 0x21, 0x0D,  // 99:3326
-  0x0D, 0x1F, 0x21, 0x0D,  // 100:3359
-  0x0D, 0x40, 0x24, 0x0D,  // 101:3392
-  0x0D, 0x64, 0x22, 0x0D,  // 102:3428
-  0x0D, 0x86, 0x21, 0x0D,  // 103:3462
-  0x0D, 0xA7, 0x21, 0x0D,  // 104:3495
-  0x0D, 0xC8, 0x1E, 0x0D,  // 105:3528
-  0x0D, 0xE6, 0x1E, 0x0D,  // 106:3558
-  0x0E, 0x04, 0x24, 0x0D,  // 107:3588
-  0x0E, 0x28, 0x1E, 0x0D,  // 108:3624
-  0x0E, 0x46, 0x24, 0x0D,  // 109:3654
-  0x0E, 0x6A, 0x21, 0x0D,  // 110:3690
-  0x0E, 0x8B, 0x24, 0x0D,  // 111:3723
-  0x0E, 0xAF, 0x23, 0x0D,  // 112:3759
-  0x0E, 0xD2, 0x21, 0x0D,  // 113:3794
-  0x0E, 0xF3, 0x20, 0x0D,  // 114:3827
-  0x0F, 0x13, 0x21, 0x0D,  // 115:3859
-  0x0F, 0x34, 0x21, 0x0D,  // 116:3892
-  0x0F, 0x55, 0x21, 0x0D,  // 117:3925
-  0x0F, 0x76, 0x23, 0x0D,  // 118:3958
-  0x0F, 0x99, 0x23, 0x0D,  // 119:3993
-  0x0F, 0xBC, 0x24, 0x0D,  // 120:4028
-  0x0F, 0xE0, 0x26, 0x0D,  // 121:4064
-  0x10, 0x06, 0x21, 0x0D,  // 122:4102
-  0x10, 0x27, 0x24, 0x0D,  // 123:4135
-  0x10, 0x4B, 0x15, 0x0D,  // 124:4171
-  0x10, 0x60, 0x1D, 0x0D,  // 125:4192
-  0x10, 0x7D, 0x23, 0x0D,  // 126:4221
-  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 128:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 129:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 130:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 131:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 132:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 133:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 134:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 135:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 136:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 137:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 138:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 139:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 140:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 141:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 142:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 143:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 144:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 145:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 146:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 147:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 148:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 149:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 150:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 151:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 152:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 153:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 154:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 155:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 156:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 157:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 158:65535
-  0xFF, 0xFF, 0x00, 0x15,  // 159:65535
-  0xFF, 0xFF, 0x00, 0x0B,  // 160:65535
-  0x10, 0xA0, 0x18, 0x0D,  // 161:4256
-  0x10, 0xB8, 0x20, 0x0D,  // 162:4280
-  0x10, 0xD8, 0x24, 0x0D,  // 163:4312
-  0x10, 0xFC, 0x21, 0x0D,  // 164:4348
-  0x11, 0x1D, 0x1C, 0x0D,  // 165:4381
-  0x11, 0x39, 0x15, 0x0D,  // 166:4409
-  0x11, 0x4E, 0x24, 0x0D,  // 167:4430
-  0x11, 0x72, 0x1C, 0x0D,  // 168:4466
-  0x11, 0x8E, 0x26, 0x0D,  // 169:4494
-  0x11, 0xB4, 0x20, 0x0D,  // 170:4532
-  0x11, 0xD4, 0x24, 0x0D,  // 171:4564
-  0x11, 0xF8, 0x24, 0x0D,  // 172:4600
-  0x12, 0x1C, 0x1D, 0x0D,  // 173:4636
-  0x12, 0x39, 0x26, 0x0D,  // 174:4665
-  0x12, 0x5F, 0x19, 0x0D,  // 175:4703
-  0x12, 0x78, 0x19, 0x0D,  // 176:4728
-  0x12, 0x91, 0x24, 0x0D,  // 177:4753
-  0x12, 0xB5, 0x1D, 0x0D,  // 178:4789
-  0x12, 0xD2, 0x1A, 0x0D,  // 179:4818
-  0x12, 0xEC, 0x13, 0x0D,  // 180:4844
-  0x12, 0xFF, 0x21, 0x0D,  // 181:4863
-  0x13, 0x20, 0x25, 0x0D,  // 182:4896
-  0x13, 0x45, 0x14, 0x0D,  // 183:4933
-  0x13, 0x59, 0x18, 0x0D,  // 184:4953
-  0x13, 0x71, 0x1D, 0x0D,  // 185:4977
-  0x13, 0x8E, 0x1F, 0x0D,  // 186:5006
-  0x13, 0xAD, 0x20, 0x0D,  // 187:5037
-  0x13, 0xCD, 0x27, 0x0D,  // 188:5069
-  0x13, 0xF4, 0x24, 0x0D,  // 189:5108
-  0x14, 0x18, 0x27, 0x0D,  // 190:5144
-  0x14, 0x3F, 0x21, 0x0D,  // 191:5183
-  0x14, 0x60, 0x27, 0x0D,  // 192:5216
-  0x14, 0x87, 0x27, 0x0D,  // 193:5255
-  0x14, 0xAE, 0x27, 0x0D,  // 194:5294
-  0x14, 0xD5, 0x27, 0x0D,  // 195:5333
-  0x14, 0xFC, 0x27, 0x0D,  // 196:5372
-  0x15, 0x23, 0x24, 0x0D,  // 197:5411
-  0x15, 0x47, 0x24, 0x0D,  // 198:5447
-  0x15, 0x6B, 0x24, 0x0D,  // 199:5483
-  0x15, 0x8F, 0x21, 0x0D,  // 200:5519
-  0x15, 0xB0, 0x21, 0x0D,  // 201:5552
-  0x15, 0xD1, 0x21, 0x0D,  // 202:5585
-  0x15, 0xF2, 0x21, 0x0D,  // 203:5618
-  0x16, 0x13, 0x24, 0x0D,  // 204:5651
-  0x16, 0x37, 0x24, 0x0D,  // 205:5687
-  0x16, 0x5B, 0x24, 0x0D,  // 206:5723
-  0x16, 0x7F, 0x24, 0x0D,  // 207:5759
-  0x16, 0xA3, 0x26, 0x0D,  // 208:5795
-  0x16, 0xC9, 0x24, 0x0D,  // 209:5833
-  0x16, 0xED, 0x26, 0x0D,  // 210:5869
-  0x17, 0x13, 0x26, 0x0D,  // 211:5907
-  0x17, 0x39, 0x26, 0x0D,  // 212:5945
-  0x17, 0x5F, 0x26, 0x0D,  // 213:5983
-  0x17, 0x85, 0x26, 0x0D,  // 214:6021
-  0x17, 0xAB, 0x21, 0x0D,  // 215:6059
-  0x17, 0xCC, 0x26, 0x0D,  // 216:6092
-  0x17, 0xF2, 0x24, 0x0D,  // 217:6130
-  0x18, 0x16, 0x24, 0x0D,  // 218:6166
-  0x18, 0x3A, 0x24, 0x0D,  // 219:6202
-  0x18, 0x5E, 0x24, 0x0D,  // 220:6238
-  0x18, 0x82, 0x1F, 0x0D,  // 221:6274
-  0x18, 0xA1, 0x23, 0x0D,  // 222:6305
-  0x18, 0xC4, 0x24, 0x0D,  // 223:6340
-  0x18, 0xE8, 0x24, 0x0D,  // 224:6376
-  0x19, 0x0C, 0x24, 0x0D,  // 225:6412
-  0x19, 0x30, 0x24, 0x0D,  // 226:6448
-  0x19, 0x54, 0x24, 0x0D,  // 227:6484
-  0x19, 0x78, 0x24, 0x0D,  // 228:6520
-  0x19, 0x9C, 0x24, 0x0D,  // 229:6556
-  0x19, 0xC0, 0x27, 0x0D,  // 230:6592
-  0x19, 0xE7, 0x24, 0x0D,  // 231:6631
-  0x1A, 0x0B, 0x24, 0x0D,  // 232:6667
-  0x1A, 0x2F, 0x24, 0x0D,  // 233:6703
-  0x1A, 0x53, 0x24, 0x0D,  // 234:6739
-  0x1A, 0x77, 0x24, 0x0D,  // 235:6775
-  0x1A, 0x9B, 0x1E, 0x0D,  // 236:6811
-  0x1A, 0xB9, 0x1E, 0x0D,  // 237:6841
-  0x1A, 0xD7, 0x1E, 0x0D,  // 238:6871
-  0x1A, 0xF5, 0x1E, 0x0D,  // 239:6901
-  0x1B, 0x13, 0x23, 0x0D,  // 240:6931
-  0x1B, 0x36, 0x1E, 0x0D,  // 241:6966
-  0x1B, 0x54, 0x24, 0x0D,  // 242:6996
-  0x1B, 0x78, 0x24, 0x0D,  // 243:7032
-  0x1B, 0x9C, 0x24, 0x0D,  // 244:7068
-  0x1B, 0xC0, 0x24, 0x0D,  // 245:7104
-  0x1B, 0xE4, 0x24, 0x0D,  // 246:7140
-  0x1C, 0x08, 0x1D, 0x0D,  // 247:7176
-  0x1C, 0x25, 0x24, 0x0D,  // 248:7205
-  0x1C, 0x49, 0x21, 0x0D,  // 249:7241
-  0x1C, 0x6A, 0x21, 0x0D,  // 250:7274
-  0x1C, 0x8B, 0x21, 0x0D,  // 251:7307
-  0x1C, 0xAC, 0x21, 0x0D,  // 252:7340
-  0x1C, 0xCD, 0x26, 0x0D,  // 253:7373
-  0x1C, 0xF3, 0x20, 0x0D,  // 254:7411
-  0x1D, 0x13, 0x26, 0x0D,  // 255:7443
+  0x00, 0x00, 0x3B, 0x15,  // 35:0
+  0xFF, 0xFF, 0x00, 0x00,  // 36:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 37:65535
+  0x00, 0x3B, 0x27, 0x15,  // 38:59
+  0xFF, 0xFF, 0x00, 0x00,  // 39:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 40:65535
+  0x00, 0x62, 0x18, 0x15,  // 41:98
+  0xFF, 0xFF, 0x00, 0x00,  // 42:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 43:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 44:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 45:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 46:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 47:65535
+  0x00, 0x7A, 0x2F, 0x15,  // 48:122
+  0xFF, 0xFF, 0x00, 0x00,  // 49:65535
+  0x00, 0xA9, 0x10, 0x15,  // 50:169
+  0x00, 0xB9, 0x31, 0x15,  // 51:185
+  0x00, 0xEA, 0x2D, 0x15,  // 52:234
+  0x01, 0x17, 0x22, 0x15,  // 53:279
+  0xFF, 0xFF, 0x00, 0x00,  // 54:65535
+  0x01, 0x39, 0x24, 0x15,  // 55:313
+  0xFF, 0xFF, 0x00, 0x00,  // 56:65535
+  0x01, 0x5D, 0x1C, 0x15,  // 57:349
+  0xFF, 0xFF, 0x00, 0x00,  // 58:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 59:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 60:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 61:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 62:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 63:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 64:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 65:65535
+  0x01, 0x79, 0x28, 0x15,  // 66:377
+  0xFF, 0xFF, 0x00, 0x00,  // 67:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 68:65535
+  0x01, 0xA1, 0x25, 0x15,  // 69:417
+  0x01, 0xC6, 0x15, 0x15,  // 70:454
+  0xFF, 0xFF, 0x00, 0x00,  // 71:65535
+  0x01, 0xDB, 0x38, 0x15,  // 72:475
+  0xFF, 0xFF, 0x00, 0x00,  // 73:65535
+  0x02, 0x13, 0x22, 0x15,  // 74:531
+  0xFF, 0xFF, 0x00, 0x00,  // 75:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 76:65535
+  0x02, 0x35, 0x08, 0x15,  // 77:565
+  0xFF, 0xFF, 0x00, 0x00,  // 78:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 79:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 80:65535
+  0x02, 0x3D, 0x2D, 0x15,  // 81:573
+  0x02, 0x6A, 0x2F, 0x15,  // 82:618
+  0x02, 0x99, 0x25, 0x15,  // 83:665
+  0xFF, 0xFF, 0x00, 0x00,  // 84:65535
+  0xFF, 0xFF, 0x00, 0x00,  // 85:65535
+  0x02, 0xBE, 0x28, 0x15,  // 86:702
+  0x02, 0xE6, 0x3E, 0x15,  // 87:742
+  0xFF, 0xFF, 0x00, 0x00,  // 88:65535
+  0x03, 0x24, 0x36, 0x15,  // 89:804
 
   // Font Data:
-  0x00,0x05,0x00,0x20,0x05,0x00,0x20,0x05,0x00,0x20,0x05,0x00,0x20,0x04,0x00,0x00,0x04,0x00,0xE0,0x05,0x00,0xF8,0x03,0x00,0xF8,0x03,0x00,0xFC,0xE3,0x00,0xFC,0xE7,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFE,0x07,0x07,0xFC,0x03,0x07,0xF8,0x03,0x00,0xF8,0x03,0x00,0xF8,0x03,0x00,0xE0, // 33
-  0xE0,0x01,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xFC,0x0F,0x00,0xFE,0x0F,0x00,0xFF,0xDF,0x06,0xFF,0x9F,0x03,0xFF,0xFF,0x0E,0xFF,0x9F,0x03,0xFF,0xDF,0x06,0xFE,0x0F,0x00,0xFC,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x00,0xF0,0x07,0x00,0xF0,0x07,0x00,0xE0,0x01,  // 34
-  0xE0,0x03,0x00,0xF0,0x87,0x00,0xF8,0xCF,0x00,0xF8,0x6F,0x01,0xF8,0xCF,0x01,0xF8,0x0F,0x00,0xFC,0x0F,0x00,0xFE,0x1F,0x09,0xFE,0x1F,0x0F,0xFF,0x1F,0x0F,0xFF,0xDF,0x1D,0xFF,0x1F,0x0F,0xFE,0x1F,0x0F,0xFE,0x1F,0x09,0xFC,0x0F,0x00,0xF8,0x0F,0x00,0xF8,0x0F,0x03,0xF8,0x8F,0x02,0xF8,0x8F,0x03,0xF0,0x07,0x00,0xE0,0x03,  // 35
-  0xE0,0x01,0x00,0xF0,0x03,0x00,0xF8,0x03,0x00,0xF8,0x77,0x00,0xF8,0x77,0x00,0xFC,0x07,0x0E,0xFE,0x07,0x0E,0xFE,0x0F,0x00,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0xFF,0xEF,0x00,0xFF,0xEF,0x00,0xFF,0x0F,0x00,0xFE,0x0F,0x00,0xFE,0x07,0x0E,0xFC,0x07,0x0E,0xF8,0x77,0x00,0xF8,0x77,0x00,0xF8,0x03,0x00,0xF0,0x03,0x00,0xE0,0x01,  // 36
-  0x00,0x78,0x00,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x00,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x01,0xF0,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xFF,0x03,0xF8,0xFF,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x01,0xFC,0xFF,0x01,0xF8,0xFF,0x01,0xF8,0xFF,0x01,0xF0,0xFF,0x01,0xF0,0xFF,0x00,0xE0,0xFF,0x00,0xC0,0x79,  // 37
-  0x00,0x0F,0x00,0xC0,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x3F,0x00,0xE0,0x3F,0x00,0xF8,0x3F,0x00,0xFC,0x3F,0x00,0xFE,0x7F,0x00,0xFE,0x7F,0x09,0xFE,0xFF,0x07,0xFF,0xFF,0x03,0xFF,0xFF,0x02,0xFF,0x7F,0x00,0xFF,0x7F,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0xFE,0x3F,0x00,0xFE,0x3F,0x00,0xFC,0x1F,0x00,0x38,0x0F,  // 38
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0xC0,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0x00,0x80,0x03, // 39
-  0x80,0x1F,0x00,0xE0,0xFF,0x00,0xF0,0xE0,0x01,0x3C,0xC0,0x03,0x1C,0x80,0x07,0x0E,0x00,0x07,0x0E,0x20,0x07,0x07,0x18,0x0E,0x07,0x1E,0x0E,0x07,0x0E,0x0E,0x07,0x0F,0x0E,0x07,0x07,0x0E,0x87,0x01,0x0E,0x8E,0x00,0x07,0x0E,0x00,0x07,0x1C,0x80,0x07,0x3C,0xC0,0x03,0xF0,0xE0,0x01,0xE0,0xFF,0x00,0x80,0x1F, // 40
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x3F,0x00,0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x07,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x1E,0x00,0x00,0x11,0x00,0x00,0x1F,0x00,0x00,0x38,0x00,0x00,0x20,  // 41
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x80,0x02,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x40, // 42
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x01,  // 43
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4E,0x00,0x00,0x6E,0x00,0x00,0x7E,0x00,0x00,0x3C,  // 44
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,  // 45
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E, // 46
-  0x00,0x00,0x08,0x00,0x00,0x0C,0x00,0x00,0x07,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x80,0x03,0x00,0xE0,0x00,0x00,0x78,0x00,0x00,0x18, // 47
-  0x00,0x0F,0x00,0x80,0x10,0x00,0xC0,0x30,0x00,0x40,0x20,0x00,0x40,0x20,0x00,0x70,0x20,0x00,0x38,0x20,0x00,0x24,0x00,0x00,0x14,0x40,0x04,0x14,0xC0,0x03,0x12,0xE0,0x01,0x11,0x10,0x00,0x11,0x40,0x00,0x21,0x60,0x00,0x21,0x20,0x00,0x42,0x20,0x00,0x46,0x20,0x00,0x44,0x20,0x00,0xC4,0x30,0x00,0x88,0x11,0x00,0x70,0x0F,  // 48
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x10,0x82,0x00,0x30,0x40,0x00,0x80,0x0F,0x00,0xC0,0x1F,0x00,0xC0,0x3F,0x00,0xE0,0x3F,0x00,0xEC,0xBF,0x03,0xE0,0x3F,0x00,0xC0,0x3F,0x00,0xC0,0x1F,0x00,0x80,0x0F,0x00,0x30,0x40,0x00,0x10,0x82,0x00,0x00,0x02,0x00,0x00,0x02,  // 49
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x80,0x3F,0x00,0x80,0x7F,0x00,0x00,0x7C,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x10,  // 50
-  0x00,0xE1,0x00,0x00,0xF9,0x03,0x04,0xF9,0x03,0x08,0xFC,0x07,0xC0,0xFF,0x07,0x60,0xFC,0x07,0x30,0xFE,0x07,0x10,0xFE,0x07,0x13,0xFF,0x0F,0x10,0xFF,0x0F,0x30,0xFF,0x0F,0xE0,0xFF,0x0F,0xC0,0xFF,0x0F,0x18,0xFE,0x07,0x08,0xFF,0x07,0x00,0xFD,0x07,0x00,0xFD,0x07,0x00,0xFC,0x07,0x00,0xF8,0x03,0x00,0xF8,0x03,0x00,0xE0,  // 51
-  0x00,0xE0,0x00,0x00,0xF8,0x03,0x00,0xF8,0x03,0x00,0xFC,0x07,0x00,0xFC,0x07,0x00,0xFC,0x07,0x00,0xFE,0x07,0x00,0xFF,0x07,0x00,0xFF,0x0F,0x80,0xFF,0x0F,0xF8,0xFF,0x0F,0x1C,0xFF,0x0F,0x3E,0xFE,0x0F,0x7E,0xFE,0x07,0xC0,0xFC,0x07,0x80,0xF9,0x07,0x80,0xFD,0x07,0x80,0xFD,0x07,0x80,0xFB,0x03,0x80,0xF8,0x03,0x00,0xF0,0x01, // 52
-  0x00,0x1E,0x00,0x00,0x3F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x01,0xF0,0xFF,0x01,0xF0,0xFF,0x01,0xF0,0xFF,0x01,0xE0,0xFF,0x00,0xE0,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0x80,0x7F,0x00,0x80,0x7F,0x00,0x00,0x3F,0x00,0x00,0x1E,  // 53
-  0xE0,0x01,0x00,0xF0,0x03,0x00,0xF8,0x07,0x00,0xF8,0x07,0x00,0xF8,0x07,0x00,0xFC,0x07,0x00,0xFE,0x07,0x00,0xFE,0x0F,0x00,0xFF,0x6F,0x02,0xFF,0xFF,0x01,0xFF,0xFF,0x00,0xFF,0x9F,0x00,0xFF,0x0F,0x00,0xFE,0x0F,0x00,0xFE,0x07,0x00,0xFC,0x07,0x00,0xF8,0x07,0x00,0xF8,0x07,0x00,0xF8,0x07,0x00,0xF0,0x03,0x00,0xE0,0x01,  // 54
-  0xC0,0x03,0x00,0xE0,0x07,0x00,0xE0,0x0F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF8,0x1F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x00,0xFE,0x3F,0x00,0xFE,0x3F,0x07,0xFE,0x3F,0x07,0xFE,0x3F,0x00,0xFC,0x1F,0x00,0xFC,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x0F,0x00,0xE0,0x0F,0x00,0xC0,0x03,  // 55
-  0xE0,0x01,0x00,0xF0,0x07,0x00,0xF8,0x07,0x00,0xF8,0x0F,0x00,0xF8,0xCF,0x00,0xF8,0xCF,0x00,0xFC,0x0F,0x00,0xFE,0x0F,0x00,0xFE,0x1F,0x00,0xFF,0x1F,0x00,0xFF,0x1F,0x0E,0xFF,0x1F,0x0E,0xFF,0x1F,0x00,0xFE,0x0F,0x00,0xFE,0x0F,0x00,0xFC,0x0F,0x03,0xF8,0x0F,0x03,0xF8,0x0F,0x00,0xF8,0x07,0x00,0xF0,0x07,0x00,0xE0,0x01,  // 56
-  0x00,0x50,0x00,0x00,0x54,0x00,0x00,0x54,0x00,0x00,0x54,0x00,0x00,0x44,0x00,0x00,0x40,0x00,0x00,0x5E,0x00,0x00,0x1F,0x00,0x00,0x3F,0x00,0x80,0x3F,0x00,0x80,0x3F,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0x80,0x3F,0x00,0x80,0x3F,0x00,0x00,0x3F,0x00,0x00,0x1F,0x00,0x00,0x1E,  // 57
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x0E,0x00,0x07,0x0E,0x00,0x07,0x0E, // 58
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x4E,0x00,0x07,0x6E,0x00,0x07,0x7E,0x00,0x00,0x3C,  // 59
-  0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xB0,0x01,0x00,0xB0,0x01,0x00,0xB0,0x01,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x06,0x0C, // 60
-  0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,0x00,0x98,0x01,  // 61
-  0x00,0x00,0x00,0x00,0x06,0x0C,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0xB0,0x01,0x00,0xB0,0x01,0x00,0xB0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x40,0x00,0x00,0x40,  // 62
-  0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0xC0,0x0C,0x30,0xF0,0x0C,0x30,0x38,0x00,0x30,0x1C,0x00,0x70,0x0E,0x00,0xE0,0x07,0x00,0xC0,0x01,  // 63
-  0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0x80,0x07,0x70,0x7C,0x06,0x38,0xFF,0x0E,0x98,0xC3,0x0C,0x98,0x61,0x0C,0x98,0x7F,0x0C,0xB8,0xFF,0x04,0x30,0xC0,0x00,0xF0,0xE0,0x00,0xC0,0x7F,0x00,0x00,0x3F,  // 64
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x00,0x00,0x24,0x00,0x00,0xA2,0x00,0x00,0xA1,0x00,0x00,0xA1,0x00,0x70,0xA1,0x00,0x00,0xA1,0x00,0x00,0xA1,0x00,0x00,0xA2,0x00,0x00,0x24,0x00,0x80,0x00,0x00,0xC0, // 65
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x30,0x82,0x00,0x20,0x40,0x00,0x00,0x0F,0x00,0x80,0x18,0x00,0xC0,0x30,0x00,0x40,0x20,0x00,0x4C,0xA0,0x03,0x40,0x20,0x00,0xC0,0x30,0x00,0x80,0x18,0x00,0x00,0x0F,0x00,0x20,0xC0,0x00,0x30,0x82,0x00,0x00,0x02,0x00,0x00,0x02,  // 66
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0xC0,0x10,0x00,0x40,0x20,0x00,0xE0,0x41,0x00,0x20,0x46,0x00,0x00,0x44,0x00,0x00,0x48,0x00,0x00,0x28,0x00,0x00,0x38,0x00,0x00,0x1C,  // 67
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x20,0x80,0x00,0x60,0xC0,0x00,0x00,0x1F,0x00,0x80,0x31,0x00,0xC0,0x7F,0x00,0xD8,0x7F,0x07,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0xC0,0x7F,0x00,0x80,0x7F,0x00,0x80,0x3F,0x00,0x00,0x0E,  // 68
-  0x00,0x00,0x00,0x80,0x08,0x00,0x80,0x0A,0x00,0x80,0x0A,0x00,0x80,0x0A,0x00,0x80,0x0F,0x00,0xC0,0x1A,0x00,0xE0,0x3A,0x00,0xA0,0x2A,0x00,0x90,0x4A,0x00,0x90,0x4A,0x00,0x90,0x4A,0x00,0x10,0x4A,0x00,0x20,0x2A,0x00,0x20,0x3A,0x00,0xC0,0x1A,0x00,0x80,0x0F,0x00,0x00,0x0A,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,  // 69
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x29,0x00,0x00,0x29,0x00,0x00,0x29,0x00,0x00,0x29,0x00,0x00,0x29,0x00,0x80,0x39,0x00,0xC0,0x39,0x00,0xC0,0x39,0x00,0xC0,0xF9,0x00,0x00,0xF8,0x00,0x00,0xF8,0x00,0x00,0x68,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x06, // 70
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x39,0x00,0x80,0x39,0x00,0x80,0x1F,0x00,0x80,0x1F,0x00,0xF0,0xF9,0x00,0xF0,0xF9,0x00,0x80,0x39,0x00,0x80,0x1F,0x00,0x80,0x3F,0x00,0x80,0x39,0x00,0x80,0x39, // 71
-  0x00,0xF1,0x01,0x00,0x19,0x03,0x04,0x0C,0x06,0x0C,0x04,0x04,0xC0,0x07,0x04,0x60,0x0C,0x04,0x30,0x06,0x06,0x10,0x03,0x04,0x17,0x01,0x08,0x10,0x01,0x08,0x30,0x01,0x08,0x60,0x01,0x08,0xC0,0x01,0x08,0x08,0x02,0x04,0x04,0x03,0x06,0x00,0x05,0x04,0x00,0x05,0x04,0x00,0x04,0x04,0x00,0x0C,0x06,0x00,0x18,0x03,0x00,0xF0,  // 72
-  0x00,0xF0,0x00,0x00,0x18,0x03,0x00,0x0C,0x02,0x00,0x04,0x04,0x00,0x04,0x04,0x00,0x04,0x04,0x00,0x06,0x06,0x00,0x03,0x04,0x00,0x01,0x0C,0x00,0x01,0x08,0xF0,0x01,0x08,0x08,0x01,0x08,0x3C,0x01,0x0C,0x40,0x03,0x04,0x80,0x06,0x06,0x00,0x05,0x04,0x00,0x05,0x04,0x00,0x07,0x04,0x00,0x0F,0x02,0x80,0x19,0x03,0x00,0xF0,  // 73
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x01,0x00,0x49,0x01,0x10,0x49,0x01,0x10,0x48,0x01,0x80,0x49,0x01,0x40,0x48,0x01,0x60,0x48,0x01,0x20,0x48,0x01,0x26,0x48,0x01,0x20,0x48,0x01,0x60,0x48,0x01,0x40,0x48,0x01,0x80,0x49,0x01,0x10,0x48,0x01,0x08,0x49,0x01,0x00,0x49,0x01,0x00,0x49,0x01, // 74
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x01,0x00,0x48,0x01,0x00,0x48,0x01,0x00,0x48,0x01,0xE0,0x4B,0x01,0x30,0x4A,0x01,0x18,0x48,0x01,0x78,0x48,0x01,0x80,0x49,0x01,0x00,0x49,0x01,0x00,0x4A,0x01,0x00,0x4A,0x01,0x00,0x4A,0x01,0x00,0x4A,0x01,0x00,0x48,0x01,0x00,0x48,0x01,0x00,0x48,0x01, // 75
-  0x80,0x4B,0x01,0x40,0x48,0x01,0x60,0x48,0x01,0x20,0x48,0x01,0x20,0x48,0x01,0x20,0x48,0x01,0x10,0x48,0x01,0x10,0x48,0x01,0x08,0x48,0x01,0x08,0x48,0x01,0x08,0x48,0x01,0x08,0x48,0x01,0x08,0x48,0x01,0x10,0x48,0x01,0x10,0x48,0x01,0x20,0x48,0x01,0x20,0x48,0x01,0x20,0x48,0x01,0x60,0x48,0x01,0x40,0x48,0x01,0x80,0x4B,0x01, // 76
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,0x00,0x20,0x25,  // 77
-  0x00,0x1E,0x00,0x00,0x21,0x00,0x80,0x61,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x60,0x60,0x00,0x20,0x40,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x20,0x40,0x00,0x60,0x60,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x40,0x00,0x80,0x61,0x00,0x00,0x21,0x00,0x00,0x1E,  // 78
-  0xE0,0x01,0x00,0x10,0x03,0x00,0x18,0x06,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x06,0x04,0x00,0x02,0x0C,0x00,0x01,0x28,0x02,0x01,0xF8,0x01,0x01,0xF8,0x00,0x01,0x08,0x00,0x01,0x08,0x00,0x02,0x0C,0x00,0x06,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x18,0x06,0x00,0x10,0x03,0x00,0xE0,0x01,  // 79
-  0xE0,0x01,0x00,0x10,0x03,0x00,0x18,0x06,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x06,0x04,0x00,0x02,0x0C,0x00,0x01,0x60,0x02,0x01,0xF0,0x01,0x01,0xF8,0x00,0x01,0x04,0x00,0x01,0x00,0x00,0x02,0x0C,0x00,0x06,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x18,0x06,0x00,0x10,0x03,0x00,0xE0,0x01,  // 80
-  0xC0,0x03,0x00,0x20,0x04,0x00,0x10,0x0C,0x00,0x10,0x08,0x00,0x10,0x08,0x00,0x18,0x08,0x00,0x0C,0x18,0x00,0x04,0x10,0x00,0x02,0x20,0x00,0x02,0x20,0x07,0x02,0x20,0x07,0x02,0x20,0x00,0x04,0x30,0x00,0x0C,0x18,0x00,0x18,0x18,0x00,0x10,0x08,0x00,0x10,0x08,0x00,0x10,0x08,0x00,0x30,0x0C,0x00,0x60,0x06,0x00,0xC0,0x03,  // 81
-  0xE0,0x01,0x00,0x10,0x03,0x00,0x18,0x06,0x00,0x08,0x04,0x00,0x08,0xE4,0x00,0x0C,0xE4,0x00,0x06,0x04,0x00,0x02,0x0C,0x00,0x01,0x08,0x00,0x01,0x08,0x0E,0x01,0x08,0x0E,0x01,0x08,0x00,0x02,0x0C,0x00,0x06,0x04,0x00,0x0C,0x04,0x03,0x08,0x04,0x03,0x08,0x04,0x00,0x08,0x04,0x00,0x10,0x02,0x00,0x30,0x03,0x00,0xE0,0x01,  // 82
-  0x00,0x48,0x00,0x00,0x4A,0x00,0x00,0x4A,0x00,0x00,0x4A,0x00,0x00,0x42,0x00,0x00,0x40,0x00,0x00,0x4E,0x00,0x00,0x11,0x00,0x80,0x20,0x00,0x80,0x20,0x00,0xC0,0x20,0x00,0x60,0x60,0x00,0x20,0x40,0x00,0x20,0x40,0x00,0x20,0x40,0x00,0x60,0x60,0x00,0xC0,0x20,0x00,0x80,0x20,0x00,0x80,0x20,0x00,0x00,0x11,0x00,0x00,0x0E,  // 83
-  0x00,0x05,0x00,0x20,0x05,0x00,0x20,0x05,0x00,0x20,0x05,0x00,0x20,0x04,0x00,0x00,0x04,0x00,0xE0,0x04,0x00,0x10,0x01,0x00,0x08,0x02,0x00,0x08,0xE2,0x00,0x04,0xE2,0x00,0x02,0x04,0x00,0x02,0x04,0x00,0x02,0x04,0x00,0x06,0x04,0x07,0x0C,0x02,0x07,0x08,0x02,0x00,0x08,0x02,0x00,0x10,0x02,0x00,0x10,0x01,0x00,0xE0, // 84
-  0xE0,0x01,0x00,0x10,0x02,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x0C,0x04,0x00,0x06,0x04,0x00,0x02,0xCC,0x06,0x01,0x88,0x03,0x01,0x88,0x02,0x01,0xE8,0x0E,0x01,0x88,0x03,0x02,0xCC,0x06,0x02,0x04,0x00,0x04,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x18,0x06,0x00,0x10,0x03,0x00,0xE0,0x01,  // 85
-  0xE0,0x01,0x00,0x10,0x02,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x0C,0x04,0x00,0x06,0x00,0x00,0x02,0x68,0x00,0x01,0x38,0x00,0x01,0x28,0x00,0x01,0xEE,0x00,0x01,0x38,0x00,0x02,0x68,0x00,0x02,0x00,0x00,0x0C,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x18,0x06,0x00,0x10,0x03,0x00,0xE0,0x01,  // 86
-  0xE0,0x03,0x00,0x30,0x86,0x00,0x18,0xCC,0x00,0x08,0x68,0x01,0x08,0xC8,0x01,0x08,0x08,0x00,0x0C,0x0C,0x00,0x06,0x18,0x09,0x02,0x10,0x0F,0x03,0x10,0x0F,0x03,0xD0,0x1D,0x03,0x10,0x0F,0x02,0x10,0x0F,0x06,0x18,0x09,0x0C,0x0C,0x00,0x08,0x08,0x00,0x08,0x08,0x03,0x08,0x88,0x02,0x18,0x8C,0x03,0x30,0x06,0x00,0xE0,0x03,  // 87
-  0xE0,0x01,0x00,0x10,0x03,0x00,0x18,0x06,0x00,0x08,0x74,0x00,0x08,0x74,0x00,0x0C,0x04,0x0E,0x02,0x04,0x0E,0x02,0x0C,0x00,0x01,0x08,0x00,0x01,0xE8,0x00,0x01,0xE8,0x00,0x01,0x08,0x00,0x02,0x0C,0x00,0x02,0x04,0x0E,0x0C,0x04,0x0E,0x08,0x04,0x00,0x08,0x74,0x00,0x08,0x74,0x00,0x10,0x02,0x00,0x30,0x03,0x00,0xE0,0x01,  // 88
-  0x00,0xF0,0x00,0x00,0x18,0x03,0x00,0x0C,0x06,0x00,0x04,0x04,0x00,0x04,0x04,0x00,0x0F,0x04,0x80,0x03,0x06,0x40,0x02,0x04,0x40,0x01,0x08,0x40,0x01,0x08,0x20,0x01,0x08,0x30,0x01,0x08,0x10,0x01,0x08,0x10,0x02,0x04,0x10,0x02,0x06,0x20,0x04,0x04,0x60,0x04,0x04,0x40,0x04,0x04,0x40,0x0C,0x06,0x80,0x18,0x03,0x00,0xF7,  // 89
-  0x00,0x0F,0x00,0x80,0x10,0x00,0xC0,0x30,0x00,0x40,0x20,0x00,0x40,0x20,0x00,0x70,0x20,0x00,0x38,0x20,0x00,0x24,0x60,0x00,0x14,0xC0,0x09,0x14,0xC0,0x07,0x12,0xC0,0x03,0x11,0x40,0x00,0x11,0x40,0x00,0x21,0x60,0x00,0x21,0x20,0x00,0x42,0x20,0x00,0x46,0x20,0x00,0x44,0x20,0x00,0xC4,0x30,0x00,0x88,0x11,0x00,0x70,0x0F,  // 90
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40, // 91
-  0x18,0x00,0x00,0x38,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x00,0x0E,0x00,0x00,0x0C,  // 92
-  0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,  // 93
-  0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x70,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0xC0,0x03,0x00,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x00,0x40, // 94
-  0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,  // 95
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0x40, // 96
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x1E,0x0E,0x00,0x06,0x0C,0x00,0x07,0x0C,0x00,0x03,0x0C,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F,  // 97
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0x00,0x0C,0x0C,0x00,0x06,0x0C,0x00,0x02,0x0C,0x00,0x03,0x0C,0x00,0x03,0x06,0x00,0x07,0x07,0x00,0xFE,0x03,0x00,0xFC, // 98
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0xFC,0x03,0x00,0x0E,0x07,0x00,0x06,0x06,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x06,0x06, // 99
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x0E,0x0E,0x00,0x06,0x0C,0x00,0x03,0x0C,0x00,0x03,0x04,0x00,0x03,0x06,0x00,0x03,0x03,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F, // 100
-  0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0x3E,0x07,0x00,0x36,0x06,0x00,0x33,0x0C,0x00,0x33,0x0C,0x00,0x33,0x0C,0x00,0x33,0x0C,0x00,0x36,0x0C,0x00,0x3E,0x06,0x00,0x38,0x06,  // 101
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0xE0,0xFF,0x0F,0xF0,0xFF,0x0F,0x38,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,  // 102
-  0x00,0x00,0x00,0x00,0xF0,0x63,0x00,0xFC,0x47,0x00,0x0E,0x4E,0x00,0x06,0x4C,0x00,0x03,0x4C,0x00,0x03,0x44,0x00,0x03,0x46,0x00,0x03,0x63,0x00,0xFF,0x7F,0x00,0xFF,0x3F, // 103
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0xFE,0x0F,0x00,0xFC,0x0F, // 104
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x18,0xFF,0x0F,0x18,0xFF,0x0F,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,  // 105
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x03,0x40,0x00,0x03,0x40,0x00,0x03,0x40,0x00,0x03,0x40,0x00,0x03,0x60,0x18,0xFF,0x7F,0x18,0xFF,0x1F,  // 106
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0x00,0x60,0x00,0x00,0xF0,0x00,0x00,0xD8,0x01,0x00,0x8C,0x03,0x00,0x06,0x07,0x00,0x03,0x0E,0x00,0x01,0x0C,0x00,0x00,0x08,  // 107
-  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,  // 108
-  0x00,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0x0C,0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0xFF,0x0F,0x00,0xFE,0x0F,0x00,0x0C,0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0xFF,0x0F,0x00,0xFE,0x0F,  // 109
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0xFE,0x0F,0x00,0xFC,0x0F, // 110
-  0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0xFE,0x07,0x00,0x06,0x06,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x06,0x06,0x00,0xFE,0x07,0x00,0xF8,0x01,  // 111
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x0C,0x0C,0x00,0x06,0x0C,0x00,0x02,0x0C,0x00,0x03,0x0C,0x00,0x03,0x06,0x00,0x07,0x07,0x00,0xFE,0x03,0x00,0xFC, // 112
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x0E,0x0E,0x00,0x06,0x0C,0x00,0x03,0x0C,0x00,0x03,0x04,0x00,0x03,0x06,0x00,0x03,0x03,0x00,0xFF,0x7F,0x00,0xFF,0x7F, // 113
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0F,0x00,0x00,0x0F,  // 114
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x07,0x00,0x3E,0x06,0x00,0x37,0x0C,0x00,0x63,0x0C,0x00,0x63,0x0C,0x00,0x63,0x0C,0x00,0xC3,0x0E,0x00,0xC6,0x07,0x00,0x80,0x03, // 115
-  0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0x00,0x06,0x0E,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x06, // 116
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F, // 117
-  0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x1F,0x00,0x00,0x7C,0x00,0x00,0xE0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0E,0x00,0x80,0x0F,0x00,0xE0,0x03,0x00,0x7C,0x00,0x00,0x1F,0x00,0x00,0x03, // 118
-  0x00,0x07,0x00,0x00,0xFF,0x01,0x00,0xF8,0x0F,0x00,0x00,0x0E,0x00,0xF8,0x03,0x00,0x1F,0x00,0x00,0x3F,0x00,0x00,0xF8,0x03,0x00,0x00,0x0E,0x00,0xF0,0x0F,0x00,0xFF,0x01,0x00,0x07, // 119
-  0x00,0x00,0x08,0x00,0x01,0x0C,0x00,0x03,0x07,0x00,0x8E,0x03,0x00,0xDC,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0xD8,0x00,0x00,0x8E,0x03,0x00,0x07,0x07,0x00,0x01,0x0C,0x00,0x00,0x08,  // 120
-  0x00,0x00,0x40,0x00,0x03,0x40,0x00,0x0F,0x40,0x00,0x3C,0x40,0x00,0xF0,0x60,0x00,0xC0,0x73,0x00,0x00,0x3F,0x00,0x00,0x0F,0x00,0xE0,0x03,0x00,0xF8,0x00,0x00,0x1E,0x00,0x00,0x07,0x00,0x00,0x01,  // 121
-  0x00,0x00,0x00,0x00,0x03,0x0C,0x00,0x03,0x0E,0x00,0x03,0x0F,0x00,0x83,0x0D,0x00,0xC3,0x0C,0x00,0x63,0x0C,0x00,0x33,0x0C,0x00,0x1B,0x0C,0x00,0x0F,0x0C,0x00,0x07,0x0C, // 122
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0xE0,0xF0,0x78,0xF0,0x9F,0x7F,0x38,0x0F,0x6F,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,  // 123
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F, // 124
-  0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x18,0x00,0x40,0x38,0x0F,0x6F,0xF0,0x9F,0x7F,0xE0,0xF0,0x78,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60, // 125
-  0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0xF0,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x70,0x00,0x00,0x30, // 126
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x7F,0x00,0xF3,0x7F,  // 161
-  0x00,0x00,0x00,0x00,0x1E,0x00,0x80,0x7F,0x00,0xC0,0xE1,0x00,0xE0,0xC0,0x01,0x60,0x80,0x01,0xFE,0xFF,0x1F,0xFE,0xFF,0x1F,0x60,0x80,0x01,0x60,0x80,0x01,0xC0,0xC0,  // 162
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x00,0x0C,0x0E,0xE0,0xFF,0x0F,0xF0,0xFF,0x0D,0x38,0x0C,0x0C,0x18,0x0C,0x0C,0x18,0x0C,0x0C,0x18,0x0C,0x0C,0x30,0x00,0x0C,0x00,0x00,0x0C,  // 163
-  0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x3D,0x03,0x80,0xFF,0x01,0x00,0xC3,0x00,0x80,0x81,0x01,0x80,0x81,0x01,0x80,0x81,0x01,0x00,0xC3,0x00,0x80,0xFF,0x01,0xC0,0x3D,0x03, // 164
-  0x30,0x00,0x00,0x70,0x98,0x01,0xC0,0x99,0x01,0x80,0x9B,0x01,0x00,0xFE,0x0F,0x00,0xFE,0x0F,0x80,0x9B,0x01,0xC0,0x99,0x01,0x70,0x98,0x01,0x30,  // 165
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xF3,0x07,0xF8,0xF3,0x07, // 166
-  0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x39,0x60,0xF0,0x7F,0x40,0x30,0xE3,0x40,0x18,0xC3,0x41,0x18,0x86,0x41,0x18,0x8C,0x43,0x18,0x0C,0x43,0x18,0x18,0x67,0x30,0xF0,0x7F,0x00,0xE0,0x3C,  // 167
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,  // 168
-  0x00,0x7F,0x00,0xC0,0x80,0x01,0x20,0x3E,0x02,0x90,0xFF,0x04,0x88,0xC1,0x08,0xC8,0x80,0x09,0xC8,0x80,0x09,0xC8,0x80,0x09,0xC8,0x80,0x09,0x10,0x00,0x04,0x20,0x00,0x02,0xC0,0x80,0x01,0x00,0x7F,  // 169
-  0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x03,0x00,0x30,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x01,0x00,0x98,0x01,0x00,0xF8,0x03,0x00,0xF8,0x03,  // 170
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0xF8,0x00,0x00,0xDE,0x03,0x00,0x8F,0x07,0x00,0x02,0x02,0x00,0x70,0x00,0x00,0xF8,0x00,0x00,0xDE,0x03,0x00,0x8F,0x07,0x00,0x02,0x02,  // 171
-  0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xE0,0x03,0x00,0xE0,0x03,  // 172
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60, // 173
-  0x00,0x7F,0x00,0xC0,0x80,0x01,0x20,0x00,0x02,0xD0,0xFF,0x05,0xC8,0xFF,0x09,0x48,0x10,0x08,0x48,0x10,0x08,0x48,0x10,0x08,0xC8,0xF8,0x08,0x90,0xEF,0x05,0xA0,0x87,0x03,0xC0,0x80,0x01,0x00,0x7F,  // 174
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60, // 175
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x98,0x01,0x00,0x08,0x01,0x00,0x08,0x01,0x00,0x98,0x01,0x00,0xF0, // 176
-  0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0xF0,0xFF,0x0C,0xF0,0xFF,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,  // 177
-  0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x00,0x10,0x1C,0x00,0x10,0x16,0x00,0x10,0x13,0x00,0x10,0x13,0x00,0x90,0x11,0x00,0xF0,0x10,0x00,0x60,0x10, // 178
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x00,0x10,0x11,0x00,0x10,0x11,0x00,0xF0,0x1E,0x00,0x60,0x0E,  // 179
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x10, // 180
-  0x00,0x00,0x00,0x00,0xFF,0x7F,0x00,0xFF,0x7F,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x80,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F, // 181
-  0x00,0x00,0x00,0x80,0x03,0x00,0xE0,0x0F,0x00,0xE0,0x0F,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0xFF,0x7F,0xF0,0xFF,0x7F,0x30,0x00,0x00,0x30,0x00,0x00,0xF0,0xFF,0x7F,0xF0,0xFF,0x7F,0x30, // 182
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,  // 183
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x70,0x00,0x00,0x40,  // 184
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x00,0x60,0x10,0x00,0x30,0x10,0x00,0xF0,0x1F,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10, // 185
-  0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0xF0,0x01,0x00,0xB8,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0xB8,0x03,0x00,0xF0,0x01,0x00,0xE0, // 186
-  0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x8F,0x07,0x00,0xDE,0x03,0x00,0xF8,0x00,0x00,0x70,0x00,0x00,0x02,0x02,0x00,0x8F,0x07,0x00,0xDE,0x03,0x00,0xF8,0x00,0x00,0x70,  // 187
-  0x60,0x08,0x08,0x30,0x08,0x0C,0xF0,0x0F,0x07,0xF0,0x8F,0x03,0x00,0xE8,0x00,0x00,0x70,0x03,0x00,0x9C,0x03,0x00,0xCE,0x02,0x00,0x67,0x02,0xC0,0xF1,0x0F,0xE0,0xF0,0x0F,0x30,0x00,0x02,0x10,0x00,0x02, // 188
-  0x60,0x08,0x08,0x30,0x08,0x0C,0xF0,0x0F,0x07,0xF0,0xCF,0x03,0x00,0xE8,0x00,0x00,0x38,0x00,0x00,0x1C,0x0C,0x00,0x17,0x0E,0xC0,0x13,0x0B,0xE0,0x90,0x09,0x30,0xF0,0x09,0x10,0xE0,0x08,  // 189
-  0x00,0x00,0x08,0x90,0x08,0x0C,0x90,0x08,0x07,0x90,0x88,0x03,0xF0,0xEF,0x00,0x60,0x77,0x03,0x00,0x9C,0x03,0x00,0xCE,0x02,0x00,0x67,0x02,0xC0,0xF1,0x0F,0xE0,0xF0,0x0F,0x30,0x00,0x02,0x10,0x00,0x02, // 190
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x7E,0x00,0x00,0x67,0x00,0x80,0x43,0x00,0xC0,0x41,0x00,0xF3,0x40,0x00,0x33,0x40,0x00,0x00,0x40,0x00,0x00,0x60, // 191
-  0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x80,0x0F,0x00,0xF0,0x03,0x00,0xFE,0x01,0xC1,0x8F,0x01,0xF1,0x81,0x01,0xF2,0x81,0x01,0xC4,0x8F,0x01,0x00,0xFE,0x01,0x00,0xF0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0C, // 192
-  0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x80,0x0F,0x04,0xF0,0x03,0x06,0xFE,0x01,0xC3,0x8F,0x01,0xF1,0x81,0x01,0xF0,0x81,0x01,0xC0,0x8F,0x01,0x00,0xFE,0x01,0x00,0xF0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0C, // 193
-  0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x80,0x0F,0x00,0xF0,0x03,0x03,0xFE,0x01,0xC1,0x8F,0x01,0xF0,0x81,0x01,0xF1,0x81,0x01,0xC3,0x8F,0x01,0x00,0xFE,0x01,0x00,0xF0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0C, // 194
-  0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x80,0x0F,0x06,0xF0,0x03,0x02,0xFE,0x01,0xC2,0x8F,0x01,0xF2,0x81,0x01,0xF2,0x81,0x01,0xC6,0x8F,0x01,0x02,0xFE,0x01,0x00,0xF0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0C, // 195
-  0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x80,0x0F,0x02,0xF0,0x03,0x02,0xFE,0x01,0xC0,0x8F,0x01,0xF0,0x81,0x01,0xF0,0x81,0x01,0xC2,0x8F,0x01,0x02,0xFE,0x01,0x00,0xF0,0x03,0x00,0x80,0x0F,0x00,0x00,0x0C, // 196
-  0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0xC0,0x0F,0x00,0xF8,0x01,0x00,0xBF,0x01,0xFC,0x87,0x01,0xF2,0x80,0x01,0xEC,0x87,0x01,0x00,0xBF,0x01,0x00,0xF8,0x01,0x00,0xC0,0x0F,0x00,0x00,0x0E,  // 197
-  0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0xE0,0x0F,0x00,0xFC,0x01,0x80,0xDF,0x00,0xF0,0xC3,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x30,0x18,0x0C,0x30,0x18,0x0C,0x30,0x18,0x0C,0x30,0x18,0x0C,  // 198
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0x81,0x07,0xE0,0x00,0x07,0x70,0x00,0x2E,0x30,0x00,0x3C,0x30,0x00,0x6C,0x30,0x00,0x4C,0x30,0x00,0x0C,0x30,0x00,0x0C,  // 199
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x30,0x18,0x0C,0x31,0x18,0x0C,0x31,0x18,0x0C,0x32,0x18,0x0C,0x34,0x18,0x0C,0x30,0x18,0x0C,0x30,0x00,0x0C, // 200
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x34,0x18,0x0C,0x32,0x18,0x0C,0x31,0x18,0x0C,0x30,0x18,0x0C,0x30,0x18,0x0C,0x30,0x18,0x0C,0x30,0x00,0x0C, // 201
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x33,0x18,0x0C,0x31,0x18,0x0C,0x30,0x18,0x0C,0x31,0x18,0x0C,0x33,0x18,0x0C,0x30,0x18,0x0C,0x30,0x00,0x0C, // 202
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF2,0xFF,0x0F,0x32,0x18,0x0C,0x30,0x18,0x0C,0x30,0x18,0x0C,0x30,0x18,0x0C,0x32,0x18,0x0C,0x32,0x18,0x0C,0x30,0x00,0x0C, // 203
-  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x31,0x00,0x0C,0xF1,0xFF,0x0F,0xF2,0xFF,0x0F,0x34,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,  // 204
-  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x0C,0x34,0x00,0x0C,0x36,0x00,0x0C,0x33,0x00,0x0C,0xF1,0xFF,0x0F,0xF0,0xFF,0x0F,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,  // 205
-  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x0C,0x30,0x00,0x0C,0x33,0x00,0x0C,0x31,0x00,0x0C,0xF0,0xFF,0x0F,0xF1,0xFF,0x0F,0x33,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,  // 206
-  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x0C,0x32,0x00,0x0C,0x32,0x00,0x0C,0x30,0x00,0x0C,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x32,0x00,0x0C,0x32,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,  // 207
-  0x00,0x18,0x00,0x00,0x18,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x30,0x18,0x0C,0x30,0x18,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x70,0x00,0x0E,0xE0,0x80,0x07,0xC0,0xFF,0x03,0x00,0x7F,  // 208
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF6,0xFF,0x0F,0xE2,0x01,0x00,0x82,0x07,0x00,0x02,0x1E,0x00,0x02,0x78,0x00,0x06,0xE0,0x01,0x02,0x80,0x07,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,  // 209
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0x00,0x07,0x71,0x00,0x0E,0x31,0x00,0x0C,0x32,0x00,0x0C,0x34,0x00,0x0C,0x70,0x00,0x0E,0xE0,0x00,0x07,0xC0,0xFF,0x03,0x00,0xFF,  // 210
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC4,0xFF,0x03,0xE6,0x00,0x07,0x73,0x00,0x0E,0x31,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x70,0x00,0x0E,0xE0,0x00,0x07,0xC0,0xFF,0x03,0x00,0xFF,  // 211
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE3,0x00,0x07,0x71,0x00,0x0E,0x30,0x00,0x0C,0x31,0x00,0x0C,0x33,0x00,0x0C,0x70,0x00,0x0E,0xE0,0x00,0x07,0xC0,0xFF,0x03,0x00,0xFF,  // 212
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC6,0xFF,0x03,0xE2,0x00,0x07,0x72,0x00,0x0E,0x32,0x00,0x0C,0x34,0x00,0x0C,0x36,0x00,0x0C,0x72,0x00,0x0E,0xE0,0x00,0x07,0xC0,0xFF,0x03,0x00,0xFF,  // 213
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC2,0xFF,0x03,0xE2,0x00,0x07,0x70,0x00,0x0E,0x30,0x00,0x0C,0x30,0x00,0x0C,0x32,0x00,0x0C,0x72,0x00,0x0E,0xE0,0x00,0x07,0xC0,0xFF,0x03,0x00,0xFF,  // 214
-  0x00,0x00,0x00,0x00,0x06,0x0C,0x00,0x0C,0x06,0x00,0x18,0x03,0x00,0xB0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xB0,0x01,0x00,0x18,0x03,0x00,0x0C,0x06,0x00,0x06,0x0C, // 215
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x08,0xC0,0xFF,0x0F,0xE0,0x00,0x07,0x70,0xC0,0x0F,0x30,0xF0,0x0C,0x30,0x3C,0x0C,0x30,0x0F,0x0C,0xF0,0x03,0x0E,0xE0,0x80,0x07,0xF0,0xFF,0x03,0x10,0xFF,  // 216
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0x00,0x00,0x0E,0x01,0x00,0x0C,0x01,0x00,0x0C,0x02,0x00,0x0C,0x04,0x00,0x0C,0x00,0x00,0x06,0xF0,0xFF,0x07,0xF0,0xFF,0x01,  // 217
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0xF4,0xFF,0x07,0x06,0x00,0x0E,0x03,0x00,0x0C,0x01,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x06,0xF0,0xFF,0x07,0xF0,0xFF,0x01,  // 218
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0x03,0x00,0x0E,0x01,0x00,0x0C,0x00,0x00,0x0C,0x01,0x00,0x0C,0x03,0x00,0x0C,0x00,0x00,0x06,0xF0,0xFF,0x07,0xF0,0xFF,0x01,  // 219
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0xF2,0xFF,0x07,0x02,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x02,0x00,0x0C,0x02,0x00,0x06,0xF0,0xFF,0x07,0xF0,0xFF,0x01,  // 220
-  0x00,0x00,0x00,0x30,0x00,0x00,0xF0,0x00,0x00,0xC4,0x03,0x00,0x06,0x0F,0x00,0x03,0xFC,0x0F,0x01,0xFC,0x0F,0x00,0x0F,0x00,0xC0,0x03,0x00,0xF0,0x00,0x00,0x30, // 221
-  0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0xC0,0x00,0x80,0xE1,0x00,0x80,0x7F,0x00,0x00,0x1E, // 222
-  0x00,0x00,0x00,0xC0,0xFF,0x0F,0xF0,0xFF,0x0F,0x30,0x00,0x00,0x18,0x0C,0x0C,0x18,0x1E,0x0C,0x18,0x1B,0x0C,0x98,0x31,0x0C,0xF8,0x60,0x0C,0x70,0x60,0x0E,0x00,0xC0,0x07,0x00,0x80,0x03,  // 223
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x1E,0x0E,0x00,0x06,0x0C,0x10,0x07,0x0C,0x30,0x03,0x0C,0x20,0x03,0x06,0x40,0x03,0x06,0x00,0x03,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F,  // 224
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x1E,0x0E,0x00,0x06,0x0C,0x40,0x07,0x0C,0x60,0x03,0x0C,0x30,0x03,0x06,0x10,0x03,0x06,0x00,0x03,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F,  // 225
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x1E,0x0E,0x00,0x06,0x0C,0x20,0x07,0x0C,0x30,0x03,0x0C,0x18,0x03,0x06,0x30,0x03,0x06,0x20,0x03,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F,  // 226
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x1E,0x0E,0x60,0x06,0x0C,0x20,0x07,0x0C,0x20,0x03,0x0C,0x40,0x03,0x06,0x40,0x03,0x06,0x60,0x03,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F,  // 227
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x1E,0x0E,0x60,0x06,0x0C,0x00,0x07,0x0C,0x00,0x03,0x0C,0x00,0x03,0x06,0x00,0x03,0x06,0x60,0x03,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F,  // 228
-  0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x1E,0x0E,0x00,0x06,0x0C,0x78,0x07,0x0C,0x48,0x03,0x0C,0x78,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F,  // 229
-  0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0x0E,0x0E,0x00,0x07,0x0C,0x00,0x03,0x0E,0x00,0x03,0x07,0x00,0xFE,0x03,0x00,0xFE,0x07,0x00,0x33,0x0E,0x00,0x33,0x0C,0x00,0x33,0x0C,0x00,0x3E,0x0C,0x00,0x3C,0x04, // 230
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0xFC,0x03,0x00,0x0E,0x07,0x00,0x06,0x0E,0x00,0x03,0x2C,0x00,0x03,0x3C,0x00,0x03,0x6C,0x00,0x03,0x4C,0x00,0x03,0x0C,0x00,0x06,0x06,  // 231
-  0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0x3E,0x07,0x00,0x36,0x06,0x10,0x33,0x0C,0x10,0x33,0x0C,0x20,0x33,0x0C,0x40,0x33,0x0C,0x00,0x36,0x0C,0x00,0x3E,0x06,0x00,0x38,0x06,  // 232
-  0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0x3E,0x07,0x00,0x36,0x06,0x40,0x33,0x0C,0x20,0x33,0x0C,0x30,0x33,0x0C,0x10,0x33,0x0C,0x00,0x36,0x0C,0x00,0x3E,0x06,0x00,0x38,0x06,  // 233
-  0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0x3E,0x07,0x20,0x36,0x06,0x30,0x33,0x0C,0x18,0x33,0x0C,0x18,0x33,0x0C,0x30,0x33,0x0C,0x00,0x36,0x0C,0x00,0x3E,0x06,0x00,0x38,0x06,  // 234
-  0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xFC,0x03,0x00,0x3E,0x07,0x60,0x36,0x06,0x00,0x33,0x0C,0x00,0x33,0x0C,0x00,0x33,0x0C,0x00,0x33,0x0C,0x60,0x36,0x0C,0x00,0x3E,0x06,0x00,0x38,0x06,  // 235
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x10,0xFF,0x0F,0x20,0xFF,0x0F,0x40,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,  // 236
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x40,0x03,0x00,0x60,0x03,0x00,0x30,0xFF,0x0F,0x10,0xFF,0x0F,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,  // 237
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x20,0x03,0x00,0x30,0x03,0x00,0x18,0xFF,0x0F,0x18,0xFF,0x0F,0x30,0x00,0x0C,0x20,0x00,0x0C,0x00,0x00,0x0C,  // 238
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x60,0x03,0x00,0x00,0x03,0x00,0x00,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0x00,0x0C,0x60,0x00,0x0C,0x00,0x00,0x0C,  // 239
-  0x00,0x00,0x00,0x00,0xF0,0x01,0x18,0xF8,0x03,0x58,0x1C,0x07,0xF8,0x0E,0x0E,0x78,0x06,0x0C,0x38,0x06,0x0C,0x7C,0x06,0x0C,0xEE,0x0C,0x0E,0xC4,0x1F,0x07,0x00,0xFF,0x03,0x00,0xFC, // 240
-  0x00,0x00,0x00,0x00,0xFF,0x0F,0x40,0xFF,0x0F,0x60,0x0C,0x00,0x20,0x06,0x00,0x60,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x60,0xFE,0x0F,0x00,0xFC,0x0F,  // 241
-  0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0xFE,0x07,0x00,0x06,0x06,0x00,0x03,0x0C,0x10,0x03,0x0C,0x30,0x03,0x0C,0x60,0x03,0x0C,0x40,0x03,0x0C,0x00,0x06,0x06,0x00,0xFE,0x07,0x00,0xF8,0x01,  // 242
-  0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0xFE,0x07,0x00,0x06,0x06,0x40,0x03,0x0C,0x20,0x03,0x0C,0x30,0x03,0x0C,0x10,0x03,0x0C,0x00,0x03,0x0C,0x00,0x06,0x06,0x00,0xFE,0x07,0x00,0xF8,0x01,  // 243
-  0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0xFE,0x07,0x00,0x06,0x06,0x20,0x03,0x0C,0x30,0x03,0x0C,0x08,0x03,0x0C,0x30,0x03,0x0C,0x20,0x03,0x0C,0x00,0x06,0x06,0x00,0xFE,0x07,0x00,0xF8,0x01,  // 244
-  0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0xFE,0x07,0x40,0x06,0x06,0x20,0x03,0x0C,0x20,0x03,0x0C,0x60,0x03,0x0C,0x40,0x03,0x0C,0x40,0x03,0x0C,0x20,0x06,0x06,0x00,0xFE,0x07,0x00,0xF8,0x01,  // 245
-  0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0xFE,0x07,0x60,0x06,0x06,0x60,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x60,0x03,0x0C,0x60,0x06,0x06,0x00,0xFE,0x07,0x00,0xF8,0x01,  // 246
-  0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xCC,0x0C,0x00,0xCC,0x0C,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0, // 247
-  0x00,0x00,0x00,0x00,0xF8,0x09,0x00,0xFC,0x0F,0x00,0x0E,0x07,0x00,0x87,0x0F,0x00,0xC3,0x0D,0x00,0x63,0x0C,0x00,0x3B,0x0C,0x00,0x1F,0x0C,0x00,0x06,0x07,0x00,0xFF,0x03,0x00,0xF9,0x01,  // 248
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x00,0x00,0x0E,0x10,0x00,0x0C,0x30,0x00,0x0C,0x60,0x00,0x06,0x40,0x00,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F, // 249
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x40,0x00,0x0E,0x60,0x00,0x0C,0x30,0x00,0x0C,0x10,0x00,0x06,0x00,0x00,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F, // 250
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x20,0x00,0x0E,0x30,0x00,0x0C,0x08,0x00,0x0C,0x30,0x00,0x06,0x20,0x00,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x0F, // 251
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x60,0xFF,0x07,0x60,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x06,0x60,0x00,0x03,0x60,0xFF,0x0F,0x00,0xFF,0x0F, // 252
-  0x00,0x00,0x40,0x00,0x03,0x40,0x00,0x0F,0x40,0x00,0x3C,0x40,0x00,0xF0,0x60,0x40,0xC0,0x63,0x20,0x00,0x3F,0x30,0x00,0x1F,0x10,0xC0,0x07,0x00,0xF8,0x00,0x00,0x3E,0x00,0x00,0x07,0x00,0x00,0x01,  // 253
-  0x00,0x00,0x00,0xF0,0xFF,0x7F,0xF0,0xFF,0x7F,0x00,0x0C,0x0C,0x00,0x06,0x0C,0x00,0x02,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0E,0x00,0x07,0x07,0x00,0xFE,0x03,0x00,0xFC,  // 254
-  0x00,0x00,0x40,0x00,0x03,0x40,0x00,0x0F,0x40,0x00,0x3C,0x40,0x60,0xF0,0x60,0x00,0xC0,0x63,0x00,0x00,0x3F,0x00,0x00,0x1F,0x00,0xC0,0x07,0x60,0xF8,0x00,0x00,0x3E,0x00,0x00,0x07,0x00,0x00,0x01 // 255
+  0x01,0xE0,0xF0,0xFD,0xF8,0x02,0xFC,0xFE,0xFE,0xFE,0xFF,0xFF,0xFE,0x00,0xFC,0xFD,0xF8,0x08,0xF0,0xE0,0x03,0x87,0xCF,0x6F,0xCF,0x0F,0x0F,0xFE,0x1F,0x00,0xDF,0xFE,0x1F,0xFE,0x0F,0xFF,0x8F,0x01,0x07,0x03,0xFE,0x00,0xFF,0x01,0xFF,0x00,0x0B,0x09,0x0F,0x0F,0x1D,0x0F,0x0F,0x09,0x00,0x00,0x03,0x02,0x03, // 35
+  0x06,0x00,0xC0,0xC0,0xE0,0xE0,0xF8,0xFC,0xFE,0xFE,0xFA,0xFF,0xFF,0xFE,0x03,0xFC,0x38,0x0F,0x1F,0xFC,0x3F,0xFF,0x7F,0xFE,0xFF,0xFF,0x7F,0xFC,0x3F,0x01,0x1F,0x0F,0xF9,0x00,0x03,0x09,0x07,0x03,0x02, // 38
+  0xF6,0x00,0x00,0xC0,0xF6,0x00,0x10,0x3F,0x02,0x04,0x08,0x10,0x3F,0x20,0x38,0x07,0x00,0x00,0x38,0x1E,0x11,0x1F,0x38,0x20, // 41
+  0x17,0x00,0x80,0xC0,0x40,0x40,0x70,0x38,0x24,0x14,0x14,0x12,0x11,0x11,0x21,0x21,0x42,0x46,0x44,0xC4,0x88,0x70,0x0F,0x10,0x30,0xFD,0x20,0x06,0x00,0x40,0xC0,0xE0,0x10,0x40,0x60,0xFD,0x20,0x02,0x30,0x11,0x0F,0xF9,0x00,0x02,0x04,0x03,0x01, // 48
+  0xFA,0x00,0xFF,0x80,0xEF,0x00,0x08,0x1E,0x3F,0x7F,0x7C,0x78,0x70,0x70,0x30,0x10, // 50
+  0xFF,0x00,0x0C,0x04,0x08,0xC0,0x60,0x30,0x10,0x13,0x10,0x30,0xE0,0xC0,0x18,0x08,0xFB,0x00,0x07,0xE1,0xF9,0xF9,0xFC,0xFF,0xFC,0xFE,0xFE,0xFC,0xFF,0x0A,0xFE,0xFF,0xFD,0xFD,0xFC,0xF8,0xF8,0xE0,0x00,0x03,0x03,0xFC,0x07,0xFC,0x0F,0xFC,0x07,0xFF,0x03, // 51
+  0xF8,0x00,0x05,0x80,0xF8,0x1C,0x3E,0x7E,0xC0,0xFC,0x80,0x03,0x00,0xE0,0xF8,0xF8,0xFE,0xFC,0x00,0xFE,0xFC,0xFF,0xFF,0xFE,0x09,0xFC,0xF9,0xFD,0xFD,0xFB,0xF8,0xF0,0x00,0x03,0x03,0xFC,0x07,0xFC,0x0F,0xFC,0x07,0xFF,0x03,0x00,0x01, // 52
+  0xFF,0x00,0xFF,0x80,0xFF,0xC0,0xFF,0xE0,0xFC,0xF0,0xFF,0xE0,0xFF,0xC0,0xFF,0x80,0xFF,0x00,0x01,0x1E,0x3F,0xFC,0x7F,0xFA,0xFF,0xFC,0x7F,0x01,0x3F,0x1E,0xF9,0x00,0xFC,0x01, // 53
+  0x02,0xC0,0xE0,0xE0,0xFE,0xF0,0x02,0xF8,0xFC,0xFC,0xFD,0xFE,0xFF,0xFC,0xFD,0xF0,0x04,0xE0,0xC0,0x03,0x07,0x0F,0xFB,0x1F,0xFD,0x3F,0xFC,0x1F,0xFF,0x0F,0x00,0x03,0xF7,0x00,0xFF,0x07, // 55
+  0xF8,0x00,0xFF,0x80,0xFC,0xC0,0xFF,0x80,0xFE,0x00,0x00,0x50,0xFE,0x54,0x03,0x44,0x40,0x5E,0x1F,0xFE,0x3F,0xFC,0x7F,0xFE,0x3F,0x01,0x1F,0x1E, // 57
+  0xFD,0x00,0x0C,0x30,0x20,0x00,0x80,0xC0,0x40,0x4C,0x40,0xC0,0x80,0x00,0x20,0x30,0xFB,0x00,0xFF,0x02,0x0E,0x82,0x40,0x0F,0x18,0x30,0x20,0xA0,0x20,0x30,0x18,0x0F,0xC0,0x82,0x02,0x02,0xF5,0x00,0x00,0x03, // 66
+  0x00,0x00,0xFC,0x80,0x02,0xC0,0xE0,0xA0,0xFE,0x90,0x04,0x10,0x20,0x20,0xC0,0x80,0xFC,0x00,0x00,0x08,0xFE,0x0A,0x03,0x0F,0x1A,0x3A,0x2A,0xFD,0x4A,0x04,0x2A,0x3A,0x1A,0x0F,0x0A,0xFE,0x02, // 69
+  0xF8,0x00,0x00,0x80,0xFE,0xC0,0xF6,0x00,0xFB,0x29,0xFE,0x39,0x07,0xF9,0xF8,0xF8,0x68,0x0E,0x0F,0x0F,0x06, // 70
+  0xFF,0x00,0x0C,0x04,0x0C,0xC0,0x60,0x30,0x10,0x17,0x10,0x30,0x60,0xC0,0x08,0x04,0xFB,0x00,0x07,0xF1,0x19,0x0C,0x04,0x07,0x0C,0x06,0x03,0xFC,0x01,0x0A,0x02,0x03,0x05,0x05,0x04,0x0C,0x18,0xF0,0x01,0x03,0x06,0xFE,0x04,0x01,0x06,0x04,0xFC,0x08,0x01,0x04,0x06,0xFE,0x04,0x01,0x06,0x03, // 72
+  0xFD,0x00,0xFF,0x10,0x0A,0x80,0x40,0x60,0x20,0x26,0x20,0x60,0x40,0x80,0x10,0x08,0xFB,0x00,0xFE,0x49,0x01,0x48,0x49,0xFA,0x48,0x01,0x49,0x48,0xFE,0x49,0xFD,0x00,0xF0,0x01, // 74
+  0xFD,0x00,0xF4,0x20,0xF9,0x00,0xF4,0x25, // 77
+  0x01,0xC0,0x20,0xFE,0x10,0x02,0x18,0x0C,0x04,0xFD,0x02,0x02,0x04,0x0C,0x18,0xFE,0x10,0x05,0x30,0x60,0xC0,0x03,0x04,0x0C,0xFE,0x08,0x01,0x18,0x10,0xFD,0x20,0x02,0x30,0x18,0x18,0xFE,0x08,0x02,0x0C,0x06,0x03,0xF8,0x00,0xFF,0x07, // 81
+  0x07,0xE0,0x10,0x18,0x08,0x08,0x0C,0x06,0x02,0xFD,0x01,0x02,0x02,0x06,0x0C,0xFE,0x08,0x0A,0x10,0x30,0xE0,0x01,0x03,0x06,0x04,0xE4,0xE4,0x04,0x0C,0xFD,0x08,0x00,0x0C,0xFC,0x04,0x02,0x02,0x03,0x01,0xF8,0x00,0xFF,0x0E,0xFE,0x00,0xFF,0x03, // 82
+  0xF9,0x00,0xFF,0x80,0x01,0xC0,0x60,0xFE,0x20,0x06,0x60,0xC0,0x80,0x80,0x00,0x00,0x48,0xFE,0x4A,0x03,0x42,0x40,0x4E,0x11,0xFE,0x20,0x00,0x60,0xFE,0x40,0x00,0x60,0xFE,0x20,0x01,0x11,0x0E, // 83
+  0x01,0xE0,0x10,0xFE,0x08,0x02,0x0C,0x06,0x02,0xFD,0x01,0xFF,0x02,0x00,0x0C,0xFE,0x08,0x04,0x18,0x10,0xE0,0x01,0x02,0xFD,0x04,0x07,0x00,0x68,0x38,0x28,0xEE,0x38,0x68,0x00,0xFD,0x04,0x02,0x06,0x03,0x01, // 86
+  0x02,0xE0,0x30,0x18,0xFE,0x08,0x02,0x0C,0x06,0x02,0xFE,0x03,0x02,0x02,0x06,0x0C,0xFE,0x08,0x17,0x18,0x30,0xE0,0x03,0x86,0xCC,0x68,0xC8,0x08,0x0C,0x18,0x10,0x10,0xD0,0x10,0x10,0x18,0x0C,0x08,0x08,0x88,0x8C,0x06,0x03,0xFE,0x00,0xFF,0x01,0xFF,0x00,0x0B,0x09,0x0F,0x0F,0x1D,0x0F,0x0F,0x09,0x00,0x00,0x03,0x02,0x03, // 87
+  0xFB,0x00,0x00,0x80,0xFE,0x40,0x01,0x20,0x30,0xFE,0x10,0x0D,0x20,0x60,0x40,0x40,0x80,0x00,0xF0,0x18,0x0C,0x04,0x04,0x0F,0x03,0x02,0xFC,0x01,0xFF,0x02,0xFE,0x04,0x05,0x0C,0x18,0xF7,0x00,0x03,0x06,0xFE,0x04,0x01,0x06,0x04,0xFC,0x08,0x01,0x04,0x06,0xFE,0x04,0x01,0x06,0x03 // 89
 };
 
-
@@ -48,3 +48,16 @@ const char inactiveSymbole[] PROGMEM = {
     B00000000,
     B00000000
 };
+
+// The symbols above converted with xbm2sprite for drawSprite()
+#define activeSymbol_width 8
+#define activeSymbol_height 8
+const uint8_t activeSymbol_sprite[] PROGMEM = {
+  0x00, 0x30, 0x48, 0x84, 0x84, 0x48, 0x30, 0x00,
+};
+
+#define inactiveSymbol_width 8
+#define inactiveSymbol_height 8
+const uint8_t inactiveSymbol_sprite[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,
+};
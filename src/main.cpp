@@ -12,6 +12,7 @@
 #include <TimeClient.h>
 #include <WundergroundClient.h>
 
+#include "allocation-counter.h"
 #include "fonts.h"
 #include "http-service.h"
 #include "images.h"
@@ -28,6 +29,25 @@ const int I2C_DISPLAY_ADDRESS = 0x3c;
 const int SDA_PIN = D2;
 const int SDC_PIN = D1;
 
+// Bytes of rendered strings kept by the display
+const int TEXT_CACHE_SIZE = 1024;
+// RAM for the fonts drawn every tick, 4 bytes per glyph (896 per font)
+const int FONT_BUDGET = 1792;
+// Bytes of drawing commands the Ui records per tick, a tick that records
+// the same commands as the one on the panel is not drawn
+const int DISPLAY_LIST_SIZE = 512;
+// Display pages sent per loop iteration, so buttons and the alarm
+// don't wait for a whole frame to go over I2C
+const int FLUSH_PAGES_PER_STEP = 2;
+// Transitions run at TRANSITION_FPS, a still frame is checked IDLE_FPS
+// times a second, often enough not to miss a second of the clock
+const int TRANSITION_FPS = 60;
+const int IDLE_FPS = 4;
+// alarm.handle() times the buzzer by loop iterations
+const int BEEPING_LOOP_INTERVAL = 33;
+// Time the display takes to dim (ms)
+const int DIM_FADE_TIME = 1500;
+
 // Button Settings
 long lastButtonClick = 0;
 const int PLUS_BUTTON_PIN = D5;
@@ -88,20 +108,69 @@ int temperature = INT32_MAX;
 const int TEMPERATURE_MA_POINT_COUNT = 3 * 60 / 10;
 MovingAverageFilter temperatureMA(TEMPERATURE_MA_POINT_COUNT);
 
+// Texts shown by the frames. They are formatted outside of ui.update(), so
+// drawing a frame never touches the heap.
+struct ForecastText
+{
+    char day[4];
+    char icon[4];
+    char temp[16];
+};
+struct ScreenText
+{
+    char time[9];
+    char date[32];
+    char weather[32];
+    char temp[16];
+    char icon[4];
+    ForecastText forecasts[3];
+};
+ScreenText screenText;
+// The texts measured with their fonts whenever they change, so the frames
+// draw them without measuring
+struct ForecastLayout
+{
+    OLEDDisplayTextLayout day;
+    OLEDDisplayTextLayout icon;
+    OLEDDisplayTextLayout temp;
+};
+struct ScreenLayout
+{
+    OLEDDisplayTextLayout time;
+    OLEDDisplayTextLayout date;
+    OLEDDisplayTextLayout weather;
+    OLEDDisplayTextLayout temp;
+    OLEDDisplayTextLayout icon;
+    ForecastLayout forecasts[3];
+};
+ScreenLayout screenLayout;
+long screenTextTime = -1;
+// Incremented whenever the weather texts change
+uint32_t weatherVersion = 0;
+
 
 
 
 // Declaring prototypes
-void drawProgress(OLEDDisplay *display, int percentage, String label);
+void drawProgress(OLEDDisplay *display, int percentage, const char *label);
 void updateTemperature();
 void updateData(OLEDDisplay *display);
+void updateClockText();
+void updateWeatherText();
+void layoutScreenText(OLEDDisplayTextLayout *layout, const char *font, const char *text);
 void drawDateTime(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
 void drawCurrentWeather(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
 void drawForecast(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
 void drawIndoor(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
-void drawForecastDetails(OLEDDisplay *display, int x, int y, int dayIndex);
+void drawForecastDetails(OLEDDisplay *display, int x, int y, int forecastIndex);
 void drawHeaderOverlay(OLEDDisplay *display, OLEDDisplayUiState *state);
 void drawAlarm(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y);
+uint32_t dateTimeVersion(OLEDDisplayUiState *state);
+uint32_t weatherTextVersion(OLEDDisplayUiState *state);
+uint32_t headerOverlayVersion(OLEDDisplayUiState *state);
+uint32_t alarmVersion(OLEDDisplayUiState *state);
+OLEDDisplayRect frameBounds(OLEDDisplayUiState *state);
+OLEDDisplayRect headerOverlayBounds(OLEDDisplayUiState *state);
 void setReadyForWeatherUpdate();
 void plusButton_click();
 void minButton_click();
@@ -117,6 +186,19 @@ FrameCallback alarmFrames[] = {drawAlarm};
 OverlayCallback overlays[] = {drawHeaderOverlay};
 int numberOfOverlays = 1;
 
+// A frame is only redrawn when its version or the version of an overlay
+// changes, otherwise ui.update() returns without touching the display
+VersionCallback normalFrameVersions[] = {dateTimeVersion, weatherTextVersion, weatherTextVersion};
+VersionCallback alarmFrameVersions[] = {alarmVersion};
+VersionCallback overlayVersions[] = {headerOverlayVersion};
+
+// The normal frames stay above the header line, so bands (and transition
+// positions) that only show the header skip them and the other way round
+BoundsCallback normalFrameBounds[] = {frameBounds, frameBounds, frameBounds};
+BoundsCallback overlayBounds[] = {headerOverlayBounds};
+unsigned long lastUiStatsTime = 0;
+uint32_t lastSuppressedCommands = 0;
+
 void setup()
 {
     Serial.begin(115200);
@@ -124,7 +206,17 @@ void setup()
     Serial.println();
 
     // Initialize dispaly
-    display.init();
+    if (!display.init())
+    {
+        Serial.println("Display init failed");
+    }
+    // Date, time and header strings are redrawn TRANSITION_FPS times a
+    // second while a frame slides in and up to IDLE_FPS times otherwise
+    display.setTextCache(TEXT_CACHE_SIZE);
+    // The weather icons are drawn rarely and stay in flash
+    display.setFontBudget(FONT_BUDGET);
+    display.promoteFont(ArialMT_Plain_10);
+    display.promoteFont(ArialMT_Plain_24);
     display.clear();
     display.flipScreenVertically();
     display.display();
@@ -132,12 +224,14 @@ void setup()
     display.setTextAlignment(TEXT_ALIGN_CENTER);
     display.setContrast(255);
 
-    display.clear();
-    display.setFont(ArialMT_Plain_16);
-    display.drawString(64, 15, "SMART CLOCK");
-    display.setFont(ArialMT_Plain_10);
-    display.drawString(64, 35, "by Henry");
-    display.display();
+    display.firstBand();
+    do
+    {
+        display.setFont(ArialMT_Plain_16);
+        display.drawString(64, 15, "SMART CLOCK");
+        display.setFont(ArialMT_Plain_10);
+        display.drawString(64, 35, "by Henry");
+    } while (display.nextBand());
     delay(2000);
 
     WiFi.mode(WIFI_AP_STA);
@@ -207,13 +301,15 @@ void setup()
     {
         delay(500);
         Serial.print(".");
-        display.clear();
-        display.drawString(64, 10, "Connecting to WiFi");
-        display.drawXbm(46, 30, 8, 8, counter % 3 == 0 ? activeSymbole : inactiveSymbole);
-        display.drawXbm(60, 30, 8, 8, counter % 3 == 1 ? activeSymbole : inactiveSymbole);
-        display.drawXbm(74, 30, 8, 8, counter % 3 == 2 ? activeSymbole : inactiveSymbole);
         display.flipScreenVertically();
-        display.display();
+        display.firstBand();
+        do
+        {
+            display.drawString(64, 10, "Connecting to WiFi");
+            display.drawSprite(46, 30, 8, 8, counter % 3 == 0 ? activeSymbol_sprite : inactiveSymbol_sprite);
+            display.drawSprite(60, 30, 8, 8, counter % 3 == 1 ? activeSymbol_sprite : inactiveSymbol_sprite);
+            display.drawSprite(74, 30, 8, 8, counter % 3 == 2 ? activeSymbol_sprite : inactiveSymbol_sprite);
+        } while (display.nextBand());
 
         counter++;
     }
@@ -225,18 +321,23 @@ void setup()
     //service.begin();
 
     // Setup UI
-    ui.setTargetFPS(30);
+    ui.setTargetFPS(TRANSITION_FPS);
+    ui.setIdleFPS(IDLE_FPS);
     ui.setActiveSymbol(activeSymbole);
     ui.setInactiveSymbol(inactiveSymbole);
     ui.setIndicatorPosition(BOTTOM);
     ui.setIndicatorDirection(LEFT_RIGHT);
     ui.setFrameAnimation(SLIDE_LEFT);
-    ui.setFrames(normalFrames, numberOfNormalFrames);
-    ui.setOverlays(overlays, numberOfOverlays);
+    ui.setTransitionEasing(EASING_EASE_IN_OUT);
+    ui.setFrames(normalFrames, numberOfNormalFrames, normalFrameVersions, normalFrameBounds);
+    ui.setOverlays(overlays, numberOfOverlays, overlayVersions, overlayBounds);
     ui.setTimePerTransition(360);
     ui.setTimePerFrame(10 * 1000);
     ui.disableAutoTransition();
+    ui.enableAsyncFlush();
     ui.init();
+    ui.setDisplayListSize(DISPLAY_LIST_SIZE);
+    display.setFlushStep(FLUSH_PAGES_PER_STEP);
 
 
     // Setup Buttons
@@ -288,7 +389,7 @@ void loop()
     {
         sleeping = false;
         display.displayOn();
-        display.setContrast(128);
+        display.fadeContrast(128, DIM_FADE_TIME);
     }
     else
     {
@@ -302,11 +403,32 @@ void loop()
         {
             sleeping = false;
             display.displayOn();
-            display.setContrast(0);
+            display.fadeContrast(0, DIM_FADE_TIME);
         }
     }
 
+    updateClockText();
+    uint32_t allocationCount = getAllocationCount();
     int remainingTimeBudget = ui.update();
+    if (getAllocationCount() != allocationCount)
+    {
+        Serial.print("ui.update() allocated ");
+        Serial.println(getAllocationCount() - allocationCount);
+    }
+    if (millis() - lastUiStatsTime > 60 * 1000)
+    {
+        // Share of the ticks that had to be drawn, near zero on a static screen,
+        // and the display commands the loop didn't have to send again
+        lastUiStatsTime = millis();
+        Serial.printf("UI drawn %u, skipped %u ticks, %u ms drawing, %u commands suppressed\n", ui.getDrawnTicks(),
+                      ui.getSkippedTicks(), ui.getDrawMicros() / 1000,
+                      display.getSuppressedCommands() - lastSuppressedCommands);
+        lastSuppressedCommands = display.getSuppressedCommands();
+    }
+    if (alarm.beeping && remainingTimeBudget > BEEPING_LOOP_INTERVAL)
+    {
+        remainingTimeBudget = BEEPING_LOOP_INTERVAL;
+    }
     if (remainingTimeBudget > 0)
     {
         delay(remainingTimeBudget);
@@ -327,15 +449,17 @@ void loop()
 
 
 
-void drawProgress(OLEDDisplay *display, int percentage, String label)
+void drawProgress(OLEDDisplay *display, int percentage, const char *label)
 {
-    display->clear();
     display->setTextAlignment(TEXT_ALIGN_CENTER);
     display->setFont(ArialMT_Plain_10);
-    display->drawString(64, 10, label);
-    display->drawProgressBar(2, 28, 124, 10, percentage);
     display->flipScreenVertically();
-    display->display();
+    display->firstBand();
+    do
+    {
+        display->drawString(64, 10, label);
+        display->drawProgressBar(2, 28, 124, 10, percentage);
+    } while (display->nextBand());
 }
 
 void updateData(OLEDDisplay *display)
@@ -350,8 +474,60 @@ void updateData(OLEDDisplay *display)
     //updateTemperature();
     lastUpdate = timeClient.getFormattedTime();
     readyForWeatherUpdate = false;
+    updateWeatherText();
     drawProgress(display, 100, "Done...");
     delay(100);
+    // The progress screen replaced the frame
+    ui.invalidate();
+}
+
+void updateClockText()
+{
+    long now = timeClient.getCurrentEpochWithUtcOffset();
+    if (now == screenTextTime)
+    {
+        return;
+    }
+    screenTextTime = now;
+    snprintf(screenText.time, sizeof(screenText.time), "%02d:%02d:%02d", timeClient.hours(),
+             timeClient.minutes(), (int)(now % 60));
+    layoutScreenText(&screenLayout.time, ArialMT_Plain_24, screenText.time);
+}
+
+void updateWeatherText()
+{
+    weatherVersion++;
+    strlcpy(screenText.date, wunderground.getDate().c_str(), sizeof(screenText.date));
+    strlcpy(screenText.weather, wunderground.getWeatherText().c_str(), sizeof(screenText.weather));
+    snprintf(screenText.temp, sizeof(screenText.temp), "%s°C", wunderground.getCurrentTemp().c_str());
+    strlcpy(screenText.icon, wunderground.getTodayIcon().c_str(), sizeof(screenText.icon));
+    for (int i = 0; i < 3; i++)
+    {
+        ForecastText &forecast = screenText.forecasts[i];
+        // Forecasts alternate between day and night, only days are shown
+        int dayIndex = i * 2;
+        String day = wunderground.getForecastTitle(dayIndex).substring(0, 3);
+        day.toUpperCase();
+        strlcpy(forecast.day, day.c_str(), sizeof(forecast.day));
+        strlcpy(forecast.icon, wunderground.getForecastIcon(dayIndex).c_str(), sizeof(forecast.icon));
+        snprintf(forecast.temp, sizeof(forecast.temp), "%s|%s", wunderground.getForecastLowTemp(dayIndex).c_str(),
+                 wunderground.getForecastHighTemp(dayIndex).c_str());
+
+        ForecastLayout &forecastLayout = screenLayout.forecasts[i];
+        layoutScreenText(&forecastLayout.day, ArialMT_Plain_10, forecast.day);
+        layoutScreenText(&forecastLayout.icon, Meteocons_Plain_21, forecast.icon);
+        layoutScreenText(&forecastLayout.temp, ArialMT_Plain_10, forecast.temp);
+    }
+    layoutScreenText(&screenLayout.date, ArialMT_Plain_10, screenText.date);
+    layoutScreenText(&screenLayout.weather, ArialMT_Plain_10, screenText.weather);
+    layoutScreenText(&screenLayout.temp, ArialMT_Plain_24, screenText.temp);
+    layoutScreenText(&screenLayout.icon, Meteocons_Plain_42, screenText.icon);
+}
+
+void layoutScreenText(OLEDDisplayTextLayout *layout, const char *font, const char *text)
+{
+    display.setFont(font);
+    display.layoutText(layout, text);
 }
 
 void updateTemperature()
@@ -380,39 +556,26 @@ void updateTemperature()
 void drawDateTime(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y)
 {
     display->setTextAlignment(TEXT_ALIGN_CENTER);
-    display->setFont(ArialMT_Plain_10);
-    String date = wunderground.getDate();
-    int textWidth = display->getStringWidth(date);
-    display->drawString(64 + x, 7 + y, date);
-    display->setFont(ArialMT_Plain_24);
-    String time = timeClient.getFormattedTime();
-    textWidth = display->getStringWidth(time);
-    display->drawString(64 + x, 17 + y, time);
+    display->drawTextLayout(64 + x, 7 + y, &screenLayout.date);
+    display->drawTextLayout(64 + x, 17 + y, &screenLayout.time);
     display->setTextAlignment(TEXT_ALIGN_LEFT);
 }
 
 void drawCurrentWeather(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y)
 {
-    display->setFont(ArialMT_Plain_10);
     display->setTextAlignment(TEXT_ALIGN_LEFT);
-    display->drawString(60 + x, 7 + y, wunderground.getWeatherText());
+    display->drawTextLayout(60 + x, 7 + y, &screenLayout.weather);
+    display->drawTextLayout(60 + x, 17 + y, &screenLayout.temp);
 
-    display->setFont(ArialMT_Plain_24);
-    String temp = wunderground.getCurrentTemp() + "°C";
-    display->drawString(60 + x, 17 + y, temp);
-    int tempWidth = display->getStringWidth(temp);
-
-    display->setFont(Meteocons_Plain_42);
-    String weatherIcon = wunderground.getTodayIcon();
-    int weatherIconWidth = display->getStringWidth(weatherIcon);
-    display->drawString(32 + x - weatherIconWidth / 2, 05 + y, weatherIcon);
+    int weatherIconWidth = screenLayout.icon.getWidth();
+    display->drawTextLayout(32 + x - weatherIconWidth / 2, 05 + y, &screenLayout.icon);
 }
 
 void drawForecast(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y)
 {
     drawForecastDetails(display, x, y + 8, 0);
-    drawForecastDetails(display, x + 44, y + 8, 2);
-    drawForecastDetails(display, x + 88, y + 8, 4);
+    drawForecastDetails(display, x + 44, y + 8, 1);
+    drawForecastDetails(display, x + 88, y + 8, 2);
 }
 
 void drawIndoor(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16_t y)
@@ -423,7 +586,9 @@ void drawIndoor(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int1
     display->setFont(ArialMT_Plain_24);
     if (temperature != INT32_MAX)
     {
-        display->drawString(64 + x, 15 + y, String(temperature) + " °C");
+        char text[16];
+        snprintf(text, sizeof(text), "%d °C", temperature);
+        display->drawString(64 + x, 15 + y, text);
     }
     else
     {
@@ -431,20 +596,13 @@ void drawIndoor(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int1
     }
 }
 
-void drawForecastDetails(OLEDDisplay *display, int x, int y, int dayIndex)
+void drawForecastDetails(OLEDDisplay *display, int x, int y, int forecastIndex)
 {
+    ForecastLayout &forecast = screenLayout.forecasts[forecastIndex];
     display->setTextAlignment(TEXT_ALIGN_CENTER);
-    display->setFont(ArialMT_Plain_10);
-    String day = wunderground.getForecastTitle(dayIndex).substring(0, 3);
-    day.toUpperCase();
-    display->drawString(x + 20, y, day);
-
-    display->setFont(Meteocons_Plain_21);
-    display->drawString(x + 20, y + 11, wunderground.getForecastIcon(dayIndex));
-
-    display->setFont(ArialMT_Plain_10);
-    display->drawString(x + 20, y + 29, wunderground.getForecastLowTemp(dayIndex) + "|" +
-                                            wunderground.getForecastHighTemp(dayIndex));
+    display->drawTextLayout(x + 20, y, &forecast.day);
+    display->drawTextLayout(x + 20, y + 11, &forecast.icon);
+    display->drawTextLayout(x + 20, y + 29, &forecast.temp);
     display->setTextAlignment(TEXT_ALIGN_LEFT);
 }
 
@@ -452,9 +610,9 @@ void drawHeaderOverlay(OLEDDisplay *display, OLEDDisplayUiState *state)
 {
     display->setColor(WHITE);
     display->setFont(ArialMT_Plain_10);
-    String time = timeClient.getFormattedTime().substring(0, 5);
     display->setTextAlignment(TEXT_ALIGN_LEFT);
-    display->drawString(0, 54, time);
+    // "HH:MM" part of the clock text
+    display->drawString(0, 54, screenText.time, 5);
     display->setTextAlignment(TEXT_ALIGN_RIGHT);
     if (alarm.getSettings().mode != OFF)
     {
@@ -477,6 +635,37 @@ void drawAlarm(OLEDDisplay *display, OLEDDisplayUiState *state, int16_t x, int16
     alarm.draw(display, state, x, y);
 }
 
+uint32_t dateTimeVersion(OLEDDisplayUiState *state)
+{
+    return screenTextTime + weatherVersion;
+}
+
+uint32_t weatherTextVersion(OLEDDisplayUiState *state)
+{
+    return weatherVersion;
+}
+
+uint32_t headerOverlayVersion(OLEDDisplayUiState *state)
+{
+    // The header shows hours and minutes
+    return screenTextTime / 60 + alarm.getVersion();
+}
+
+uint32_t alarmVersion(OLEDDisplayUiState *state)
+{
+    return alarm.getVersion();
+}
+
+OLEDDisplayRect frameBounds(OLEDDisplayUiState *state)
+{
+    return {0, 0, 128, 53};
+}
+
+OLEDDisplayRect headerOverlayBounds(OLEDDisplayUiState *state)
+{
+    return {0, 53, 128, 11};
+}
+
 
 
 
@@ -505,6 +694,7 @@ void enterButton_click()
     Serial.print("enter ");
     Serial.println(millis());
     lastActiveTime = millis();
+    ui.wake();
     if (sleeping)
     {
         sleeping = false;
@@ -533,7 +723,7 @@ void enterButton_click()
         }
         uiMode = ALARM;
         alarm.beginSetting();
-        ui.setFrames(alarmFrames, 1);
+        ui.setFrames(alarmFrames, 1, alarmFrameVersions);
         ui.disableAutoTransition();
         ui.disableAllIndicators();
     }
@@ -543,7 +733,7 @@ void enterButton_click()
         if (!hasNextStage)
         {
             uiMode = NORMAL;
-            ui.setFrames(normalFrames, numberOfNormalFrames);
+            ui.setFrames(normalFrames, numberOfNormalFrames, normalFrameVersions, normalFrameBounds);
             //ui.enableAutoTransition();
             ui.enableAllIndicators();
         }
@@ -565,6 +755,7 @@ void plusButton_click()
     Serial.print("+ ");
     Serial.println(millis());
     lastActiveTime = millis();
+    ui.wake();
     if (sleeping)
     {
         sleeping = false;
@@ -603,6 +794,7 @@ void minButton_click()
     Serial.print("- ");
     Serial.println(millis());
     lastActiveTime = millis();
+    ui.wake();
     if (sleeping)
     {
         sleeping = false;